@@ -0,0 +1,539 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "Collation.h"
+
+#include <cstring>
+
+namespace ibd_ninja {
+
+Collation::Collation(const std::string& name) : name_(name) {
+  static const struct {
+    const char* name;
+    Kind kind;
+    bool pad_space;
+    Fold fold;
+  } kKnown[] = {
+    {"utf8mb4_0900_ai_ci", UCA_AI_CI, false, FOLD_CASE_AND_ACCENTS},
+    {"utf8mb4_0900_as_cs", UCA_AS_CS, false, FOLD_NONE},
+    {"utf8mb4_general_ci", GENERAL_CI, true, FOLD_CASE_AND_ACCENTS},
+    {"utf8mb3_general_ci", GENERAL_CI, true, FOLD_CASE_AND_ACCENTS},
+    {"utf8mb4_bin", BINARY, true, FOLD_NONE},
+    {"utf8mb3_bin", BINARY, true, FOLD_NONE},
+    {"utf8mb4_0900_bin", BINARY, false, FOLD_NONE},
+    {"binary", BINARY, false, FOLD_NONE}
+  };
+  for (const auto& known : kKnown) {
+    if (name == known.name) {
+      kind_ = known.kind;
+      pad_space_ = known.pad_space;
+      fold_ = known.fold;
+      charset_ = UTF8;
+      return;
+    }
+  }
+  // The others are approximated from their names, such as
+  // utf8mb4_unicode_ci, latin1_swedish_ci or utf8mb4_0900_as_ci
+  auto has_prefix = [&](const char* prefix) {
+    return name.compare(0, strlen(prefix), prefix) == 0;
+  };
+  auto has_suffix = [&](const char* suffix) {
+    size_t len = strlen(suffix);
+    return name.size() >= len &&
+           name.compare(name.size() - len, len, suffix) == 0;
+  };
+  if (has_prefix("utf8mb4_") || has_prefix("utf8mb3_") ||
+      has_prefix("utf8_")) {
+    charset_ = UTF8;
+  } else if (has_prefix("latin1_") || has_prefix("ascii_")) {
+    charset_ = LATIN1;
+  }
+  pad_space_ = (name.find("_0900_") == std::string::npos &&
+                name.find("_nopad_") == std::string::npos);
+  if (has_suffix("_as_ci")) {
+    fold_ = FOLD_CASE;
+  } else if (has_suffix("_ci")) {
+    fold_ = FOLD_CASE_AND_ACCENTS;
+  }
+}
+
+// Reads the character at *pos and moves past it. Returns false if the
+// bytes are not valid UTF-8.
+static bool NextCodePoint(const char* str, size_t len, size_t* pos,
+                          uint32_t* cp) {
+  const unsigned char* s = reinterpret_cast<const unsigned char*>(str);
+  unsigned char c = s[*pos];
+  uint32_t n_bytes = 0;
+  uint32_t min = 0;
+  if (c < 0x80) {
+    *cp = c;
+    (*pos)++;
+    return true;
+  } else if (c >= 0xC2 && c <= 0xDF) {
+    n_bytes = 2;
+    min = 0x80;
+    *cp = c & 0x1F;
+  } else if (c >= 0xE0 && c <= 0xEF) {
+    n_bytes = 3;
+    min = 0x800;
+    *cp = c & 0x0F;
+  } else if (c >= 0xF0 && c <= 0xF4) {
+    n_bytes = 4;
+    min = 0x10000;
+    *cp = c & 0x07;
+  } else {
+    return false;
+  }
+  if (*pos + n_bytes > len) {
+    return false;
+  }
+  for (uint32_t i = 1; i < n_bytes; i++) {
+    unsigned char cc = s[*pos + i];
+    if ((cc & 0xC0) != 0x80) {
+      return false;
+    }
+    *cp = (*cp << 6) | (cc & 0x3F);
+  }
+  if (*cp < min || *cp > 0x10FFFF || (*cp >= 0xD800 && *cp <= 0xDFFF)) {
+    return false;
+  }
+  *pos += n_bytes;
+  return true;
+}
+
+/* ------ utf8mb4_0900_ai_ci and utf8mb4_0900_as_cs ------ */
+
+// The DUCET secondary weights of the accents of the Latin-1 letters
+enum Accent : uint8_t {
+  NO_ACCENT = 0,
+  ACUTE = 0x24,
+  GRAVE = 0x25,
+  CIRCUMFLEX = 0x27,
+  RING = 0x29,
+  DIAERESIS = 0x2B,
+  TILDE = 0x2D,
+  CEDILLA = 0x30
+};
+// Secondary weight of a character without accent
+static const uint16_t kUcaBaseSecondary = 0x20;
+// Tertiary weights, the accent itself has the lower case one
+static const uint16_t kUcaLowerTertiary = 0x02;
+static const uint16_t kUcaUpperTertiary = 0x08;
+
+// The ASCII characters that have a primary weight, in DUCET order. Upper
+// case letters have the weight of their lower case, the other control
+// characters are ignorable.
+static const char kUcaAsciiOrder[] =
+    "\t\n\v\f\r _-,;:!?.'\"()[]{}@*/\\&#%`^+<=>|~$0123456789"
+    "abcdefghijklmnopqrstuvwxyz";
+
+// The Latin-1 letters from U+00C0 on, as their ASCII letter and accent.
+// A 0 letter marks the characters that are not supported.
+struct Latin1Letter {
+  char letter;
+  Accent accent;
+};
+static const Latin1Letter kLatin1Letters[64] = {
+  // U+00C0: A with grave, acute, circumflex, tilde, diaeresis and ring,
+  // AE, C with cedilla
+  {'A', GRAVE}, {'A', ACUTE}, {'A', CIRCUMFLEX}, {'A', TILDE},
+  {'A', DIAERESIS}, {'A', RING}, {0, NO_ACCENT}, {'C', CEDILLA},
+  // U+00C8: E and I with grave, acute, circumflex and diaeresis
+  {'E', GRAVE}, {'E', ACUTE}, {'E', CIRCUMFLEX}, {'E', DIAERESIS},
+  {'I', GRAVE}, {'I', ACUTE}, {'I', CIRCUMFLEX}, {'I', DIAERESIS},
+  // U+00D0: ETH, N with tilde, O with grave, acute, circumflex, tilde and
+  // diaeresis, multiplication sign
+  {0, NO_ACCENT}, {'N', TILDE}, {'O', GRAVE}, {'O', ACUTE},
+  {'O', CIRCUMFLEX}, {'O', TILDE}, {'O', DIAERESIS}, {0, NO_ACCENT},
+  // U+00D8: O with stroke, U with grave, acute, circumflex and diaeresis,
+  // Y with acute, THORN, sharp S
+  {0, NO_ACCENT}, {'U', GRAVE}, {'U', ACUTE}, {'U', CIRCUMFLEX},
+  {'U', DIAERESIS}, {'Y', ACUTE}, {0, NO_ACCENT}, {0, NO_ACCENT},
+  // U+00E0 to U+00FF: the same in lower case, with the division sign in
+  // place of the multiplication sign, and y with diaeresis last
+  {'a', GRAVE}, {'a', ACUTE}, {'a', CIRCUMFLEX}, {'a', TILDE},
+  {'a', DIAERESIS}, {'a', RING}, {0, NO_ACCENT}, {'c', CEDILLA},
+  {'e', GRAVE}, {'e', ACUTE}, {'e', CIRCUMFLEX}, {'e', DIAERESIS},
+  {'i', GRAVE}, {'i', ACUTE}, {'i', CIRCUMFLEX}, {'i', DIAERESIS},
+  {0, NO_ACCENT}, {'n', TILDE}, {'o', GRAVE}, {'o', ACUTE},
+  {'o', CIRCUMFLEX}, {'o', TILDE}, {'o', DIAERESIS}, {0, NO_ACCENT},
+  {0, NO_ACCENT}, {'u', GRAVE}, {'u', ACUTE}, {'u', CIRCUMFLEX},
+  {'u', DIAERESIS}, {'y', ACUTE}, {0, NO_ACCENT}, {'y', DIAERESIS}
+};
+
+static uint16_t UcaAsciiPrimary(unsigned char c) {
+  static uint16_t primaries[128] = {0};
+  static bool initialized = [] {
+    for (size_t i = 0; kUcaAsciiOrder[i] != '\0'; i++) {
+      unsigned char ch = kUcaAsciiOrder[i];
+      primaries[ch] = i + 1;
+      if (ch >= 'a' && ch <= 'z') {
+        primaries[ch - 'a' + 'A'] = i + 1;
+      }
+    }
+    return true;
+  }();
+  (void)initialized;
+  return primaries[c];
+}
+
+// The collation elements of a character: a primary weight, 0 for the
+// ignorable ones, a case, and the accent that follows as its own element
+struct UcaChar {
+  uint16_t primary = 0;
+  uint16_t tertiary = kUcaLowerTertiary;
+  Accent accent = NO_ACCENT;
+};
+
+static bool GetUcaChar(uint32_t cp, UcaChar* c) {
+  if (cp < 0x80) {
+    c->primary = UcaAsciiPrimary(cp);
+    c->tertiary = (cp >= 'A' && cp <= 'Z') ? kUcaUpperTertiary :
+                                              kUcaLowerTertiary;
+    c->accent = NO_ACCENT;
+    return true;
+  }
+  if (cp < 0xC0 || cp > 0xFF) {
+    return false;
+  }
+  const Latin1Letter& letter = kLatin1Letters[cp - 0xC0];
+  if (letter.letter == 0) {
+    return false;
+  }
+  c->primary = UcaAsciiPrimary(letter.letter);
+  c->tertiary = (letter.letter <= 'Z') ? kUcaUpperTertiary :
+                                         kUcaLowerTertiary;
+  c->accent = letter.accent;
+  return true;
+}
+
+// Yields the weights of a text at one level, skipping the ignorable
+// characters, and 0 once the text is over
+class UcaWeights {
+ public:
+  UcaWeights(const char* str, size_t len, int level)
+    : str_(str), len_(len), level_(level) {
+  }
+
+  // Returns false if the next character is not supported
+  bool Next(uint16_t* weight) {
+    if (pending_ != 0) {
+      *weight = pending_;
+      pending_ = 0;
+      return true;
+    }
+    while (pos_ < len_) {
+      uint32_t cp = 0;
+      UcaChar c;
+      if (!NextCodePoint(str_, len_, &pos_, &cp) || !GetUcaChar(cp, &c)) {
+        return false;
+      }
+      if (c.primary == 0) {
+        continue;
+      }
+      if (level_ == 1) {
+        *weight = c.primary;
+      } else if (level_ == 2) {
+        *weight = kUcaBaseSecondary;
+        pending_ = c.accent;
+      } else {
+        *weight = c.tertiary;
+        pending_ = c.accent != NO_ACCENT ? kUcaLowerTertiary : 0;
+      }
+      return true;
+    }
+    *weight = 0;
+    return true;
+  }
+
+ private:
+  const char* str_;
+  size_t len_;
+  int level_;
+  size_t pos_ = 0;
+  // Weight of the accent of the last character, yielded next
+  uint16_t pending_ = 0;
+};
+
+bool Collation::CompareUca(const char* a, size_t a_len,
+                           const char* b, size_t b_len, int* cmp) const {
+  // Each level is only looked at when the ones before are all equal
+  int n_levels = (kind_ == UCA_AI_CI) ? 1 : 3;
+  for (int level = 1; level <= n_levels; level++) {
+    UcaWeights a_weights(a, a_len, level);
+    UcaWeights b_weights(b, b_len, level);
+    while (true) {
+      uint16_t a_weight = 0;
+      uint16_t b_weight = 0;
+      if (!a_weights.Next(&a_weight) || !b_weights.Next(&b_weight)) {
+        return false;
+      }
+      if (a_weight != b_weight) {
+        *cmp = a_weight < b_weight ? -1 : 1;
+        return true;
+      }
+      if (a_weight == 0) {
+        break;
+      }
+    }
+  }
+  *cmp = 0;
+  return true;
+}
+
+/* ------ One weight per character ------ */
+
+// The sort mapping of utf8mb4_general_ci from U+00C0 on: the upper case
+// letter without accent, or the upper case of the letters that are not
+// made of an ASCII letter and an accent
+static const uint16_t kGeneralCiLatin1[64] = {
+  'A', 'A', 'A', 'A', 'A', 'A', 0xC6, 'C',
+  'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I',
+  0xD0, 'N', 'O', 'O', 'O', 'O', 'O', 0xD7,
+  0xD8, 'U', 'U', 'U', 'U', 'Y', 0xDE, 'S',
+  'A', 'A', 'A', 'A', 'A', 'A', 0xC6, 'C',
+  'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I',
+  0xD0, 'N', 'O', 'O', 'O', 'O', 'O', 0xF7,
+  0xD8, 'U', 'U', 'U', 'U', 'Y', 0xDE, 'Y'
+};
+
+static bool GeneralCiWeight(uint32_t cp, uint32_t* weight) {
+  if (cp >= 'a' && cp <= 'z') {
+    *weight = cp - 'a' + 'A';
+  } else if (cp < 0xC0) {
+    // MICRO SIGN sorts as GREEK CAPITAL LETTER MU
+    *weight = (cp == 0xB5) ? 0x39C : cp;
+  } else if (cp <= 0xFF) {
+    *weight = kGeneralCiLatin1[cp - 0xC0];
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// The Latin letters from U+00C0 to U+017F as the upper case ASCII letters
+// that have the same DUCET primary weights, one or two each. A '.' marks
+// the characters that have weights of their own.
+static const char kLatinBase[] =
+    "A A A A A A AEC E E E E I I I I "  // U+00C0
+    "D N O O O O O . O U U U U Y . SS"  // U+00D0
+    "A A A A A A AEC E E E E I I I I "  // U+00E0
+    "D N O O O O O . O U U U U Y . Y "  // U+00F0
+    "A A A A A A C C C C C C C C D D "  // U+0100
+    "D D E E E E E E E E E E G G G G "  // U+0110
+    "G G G G H H H H I I I I I I I I "  // U+0120
+    "I . IJIJJ J K K . L L L L L L L "  // U+0130
+    "L L L N N N N N N . . . O O O O "  // U+0140
+    "O O OEOER R R R R R S S S S S S "  // U+0150
+    "S S T T T T . . U U U U U U U U "  // U+0160
+    "U U U U W W Y Y Y Z Z Z Z Z Z S ";  // U+0170
+
+// The upper case of the Latin letters up to U+017F, of the basic Greek
+// letters, of Cyrillic and of the full-width Latin letters
+static uint32_t ToUpper(uint32_t cp) {
+  if (cp < 0x100) {
+    if ((cp >= 'a' && cp <= 'z') ||
+        (cp >= 0xE0 && cp <= 0xFE && cp != 0xF7)) {
+      return cp - 0x20;
+    }
+    return cp == 0xB5 ? 0x39C : (cp == 0xFF ? 0x178 : cp);
+  }
+  if (cp < 0x180) {
+    if (cp == 0x131 || cp == 0x17F) {
+      // DOTLESS I and LONG S
+      return cp == 0x131 ? 'I' : 'S';
+    }
+    // Pairs of an upper and a lower case letter, in this order, or the
+    // other way around
+    if ((cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) {
+      return cp & ~1U;
+    }
+    if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) {
+      return cp % 2 == 0 ? cp - 1 : cp;
+    }
+    return cp;
+  }
+  if (cp >= 0x3AC && cp <= 0x3CE) {
+    if (cp == 0x3C2) {
+      // FINAL SIGMA
+      return 0x3A3;
+    }
+    if (cp >= 0x3B1 && cp <= 0x3CB) {
+      return cp - 0x20;
+    }
+    // The lower case letters with tonos
+    return cp == 0x3AC ? 0x386 : (cp <= 0x3AF ? cp - 0x25 :
+                                  (cp == 0x3CC ? 0x38C : cp - 0x3F));
+  }
+  if (cp >= 0x430 && cp <= 0x52F) {
+    if (cp <= 0x44F) {
+      return cp - 0x20;
+    }
+    if (cp <= 0x45F) {
+      return cp - 0x50;
+    }
+    if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF) ||
+        cp >= 0x4D0) {
+      return cp & ~1U;
+    }
+    if (cp >= 0x4C1 && cp <= 0x4CE) {
+      return cp % 2 == 0 ? cp - 1 : cp;
+    }
+    return cp == 0x4CF ? 0x4C0 : cp;
+  }
+  if (cp >= 0xFF41 && cp <= 0xFF5A) {
+    return cp - 0x20;
+  }
+  return cp;
+}
+
+// Yields one weight per character, and 0 once the text is over: the
+// exact weights of GENERAL_CI and BINARY, or the folded code points of an
+// approximate comparison
+class Collation::CharWeights {
+ public:
+  CharWeights(const Collation& collation, const char* str, size_t len,
+              bool approximate)
+    : collation_(collation), str_(str), len_(len),
+      approximate_(approximate) {
+  }
+
+  bool Done() const {
+    return pos_ == len_ && pending_ == 0;
+  }
+  // Returns false if the next character has no exact weight
+  bool Next(uint32_t* weight) {
+    if (pending_ != 0) {
+      *weight = pending_;
+      pending_ = 0;
+      return true;
+    }
+    if (pos_ == len_) {
+      *weight = 0;
+      return true;
+    }
+    if (!approximate_) {
+      if (collation_.kind_ != GENERAL_CI) {
+        // UTF-8 bytes sort as their code points
+        *weight = static_cast<unsigned char>(str_[pos_++]);
+        return true;
+      }
+      uint32_t cp = 0;
+      return NextCodePoint(str_, len_, &pos_, &cp) &&
+             GeneralCiWeight(cp, weight);
+    }
+    uint32_t cp = static_cast<unsigned char>(str_[pos_]);
+    if (collation_.charset_ != UTF8 ||
+        !NextCodePoint(str_, len_, &pos_, &cp)) {
+      // A byte that is not part of a valid character sorts as itself
+      pos_++;
+    }
+    if (collation_.charset_ == OTHER_CHARSET) {
+      *weight = cp;
+      return true;
+    }
+    // The exact weights are kept for the characters that have one
+    if (collation_.kind_ == GENERAL_CI && GeneralCiWeight(cp, weight)) {
+      return true;
+    }
+    if (collation_.fold_ == FOLD_CASE_AND_ACCENTS &&
+        cp >= 0xC0 && cp < 0x180 && kLatinBase[2 * (cp - 0xC0)] != '.') {
+      const char* base = &kLatinBase[2 * (cp - 0xC0)];
+      cp = base[0];
+      if (base[1] != ' ') {
+        pending_ = base[1];
+      }
+    }
+    *weight = (collation_.fold_ != FOLD_NONE) ? ToUpper(cp) : cp;
+    return true;
+  }
+
+ private:
+  const Collation& collation_;
+  const char* str_;
+  size_t len_;
+  bool approximate_;
+  size_t pos_ = 0;
+  // Second letter of the last character, yielded next
+  uint32_t pending_ = 0;
+};
+
+bool Collation::CompareChars(const char* a, size_t a_len,
+                             const char* b, size_t b_len, bool approximate,
+                             int* cmp) const {
+  CharWeights a_weights(*this, a, a_len, approximate);
+  CharWeights b_weights(*this, b, b_len, approximate);
+  while (!a_weights.Done() || !b_weights.Done()) {
+    // With PAD SPACE, the shorter text is compared as if padded with
+    // spaces, so trailing spaces don't count, but characters that sort
+    // before space still do. Otherwise it is the first.
+    if (!pad_space_ && (a_weights.Done() || b_weights.Done())) {
+      *cmp = a_weights.Done() ? -1 : 1;
+      return true;
+    }
+    uint32_t a_weight = ' ';
+    uint32_t b_weight = ' ';
+    if ((!a_weights.Done() && !a_weights.Next(&a_weight)) ||
+        (!b_weights.Done() && !b_weights.Next(&b_weight))) {
+      return false;
+    }
+    if (a_weight != b_weight) {
+      *cmp = a_weight < b_weight ? -1 : 1;
+      return true;
+    }
+  }
+  *cmp = 0;
+  return true;
+}
+
+bool Collation::Supports(const char* str, size_t len) const {
+  if (kind_ == UCA_AI_CI || kind_ == UCA_AS_CS) {
+    UcaWeights weights(str, len, 1);
+    uint16_t weight = 0;
+    do {
+      if (!weights.Next(&weight)) {
+        return false;
+      }
+    } while (weight != 0);
+    return true;
+  }
+  if (kind_ == APPROXIMATE) {
+    return false;
+  }
+  CharWeights weights(*this, str, len, false);
+  uint32_t weight = 0;
+  while (!weights.Done()) {
+    if (!weights.Next(&weight)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Collation::Compare(const char* a, size_t a_len,
+                        const char* b, size_t b_len, int* cmp) const {
+  switch (kind_) {
+    case UCA_AI_CI:
+    case UCA_AS_CS:
+      return CompareUca(a, a_len, b, b_len, cmp);
+    case GENERAL_CI:
+    case BINARY:
+      return CompareChars(a, a_len, b, b_len, false, cmp);
+    case APPROXIMATE:
+    default:
+      return false;
+  }
+}
+
+int Collation::CompareApproximately(const char* a, size_t a_len,
+                                    const char* b, size_t b_len,
+                                    bool* approximated) const {
+  int cmp = 0;
+  if (!Compare(a, a_len, b, b_len, &cmp)) {
+    CompareChars(a, a_len, b, b_len, true, &cmp);
+    *approximated = true;
+  }
+  return cmp;
+}
+
+}  // namespace ibd_ninja
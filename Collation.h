@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef COLLATION_H_
+#define COLLATION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ibd_ninja {
+
+// The sort order of the character data of a column. It is exactly the one
+// of MySQL for these collations:
+//
+// - utf8mb4_0900_ai_ci and utf8mb4_0900_as_cs, with the DUCET weights of
+//   the characters up to U+00FF: the control characters, which are
+//   ignored except for TAB to CR, ASCII, and the Latin-1 letters made of
+//   an ASCII letter and an accent. AE, ETH, O with stroke, THORN, sharp
+//   S, the multiplication and division signs, the other Latin-1 symbols
+//   and any character above U+00FF are not supported.
+// - utf8mb4_general_ci and utf8mb3_general_ci, with the sort mapping of
+//   the characters up to U+00FF
+// - utf8mb4_bin, utf8mb3_bin and utf8mb4_0900_bin, by code point
+// - binary, byte by byte
+//
+// Other collations, and text with a character that is not supported, can
+// only be compared approximately: by code point, after folding the case
+// of the _ci collations and the accents of the ones that are not _as_ci.
+// Folding covers Latin up to U+017F, the basic Greek letters, Cyrillic and
+// the full-width Latin letters. Text of a character set other than utf8mb3,
+// utf8mb4, latin1 and ascii is compared byte by byte.
+//
+// The 0900 collations are NO PAD, the others ignore trailing spaces.
+class Collation {
+ public:
+  // The binary collation of binary strings and the text of other values,
+  // which are compared byte by byte
+  Collation() : Collation("binary") {
+  }
+  // name is the one of Column::CollationName()
+  explicit Collation(const std::string& name);
+
+  const std::string& name() const {
+    return name_;
+  }
+  // Whether the sort order of MySQL is known, for the text Supports
+  bool exact() const {
+    return kind_ != APPROXIMATE;
+  }
+  // Whether every character of the text str has an exact weight
+  bool Supports(const char* str, size_t len) const;
+  // Sets cmp to less than, equal to or greater than 0 as the text a sorts
+  // before, equal to or after b. Returns false if a or b can't be compared
+  // exactly.
+  bool Compare(const char* a, size_t a_len, const char* b, size_t b_len,
+               int* cmp) const;
+  // Like Compare, but compares a and b approximately when they can't be
+  // compared exactly, and then sets *approximated.
+  int CompareApproximately(const char* a, size_t a_len,
+                           const char* b, size_t b_len,
+                           bool* approximated) const;
+
+ private:
+  enum Kind {
+    // Primary weights only
+    UCA_AI_CI,
+    // Primary, then secondary (accent) and tertiary (case) weights
+    UCA_AS_CS,
+    // One weight per character, its upper case without accent
+    GENERAL_CI,
+    // The bytes, which follow code point order in UTF-8
+    BINARY,
+    // The sort order is not known
+    APPROXIMATE
+  };
+  // What an approximate comparison ignores
+  enum Fold {
+    FOLD_NONE,
+    FOLD_CASE,
+    FOLD_CASE_AND_ACCENTS
+  };
+  enum Charset {
+    UTF8,
+    LATIN1,
+    OTHER_CHARSET
+  };
+
+  class CharWeights;
+
+  bool CompareUca(const char* a, size_t a_len, const char* b, size_t b_len,
+                  int* cmp) const;
+  // Compares the weights of the characters one by one, the approximate
+  // ones or the exact ones of GENERAL_CI and BINARY
+  bool CompareChars(const char* a, size_t a_len, const char* b, size_t b_len,
+                    bool approximate, int* cmp) const;
+
+  std::string name_;
+  Kind kind_ = APPROXIMATE;
+  bool pad_space_ = true;
+  Fold fold_ = FOLD_NONE;
+  Charset charset_ = OTHER_CHARSET;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // COLLATION_H_
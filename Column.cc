@@ -7,6 +7,7 @@
 #include "JSONHelpers.h"
 
 #include <cassert>
+#include <cstring>
 
 namespace ibd_ninja {
 
@@ -22,6 +23,28 @@ const std::set<std::string> Column::default_valid_option_keys = {
   "gipk" /* generated implicit primary key column */
 };
 
+static const char kBase64Chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static std::string Base64Decode(const char* in) {
+  std::string out;
+  uint32_t bits = 0;
+  int n_bits = 0;
+  for (; *in != '\0' && *in != '='; in++) {
+    const char* p = strchr(kBase64Chars, *in);
+    if (p == nullptr) {
+      continue;
+    }
+    bits = (bits << 6) | static_cast<uint32_t>(p - kBase64Chars);
+    n_bits += 6;
+    if (n_bits >= 8) {
+      n_bits -= 8;
+      out.push_back(static_cast<char>((bits >> n_bits) & 0xFF));
+    }
+  }
+  return out;
+}
+
 bool Column::Init(const rapidjson::Value& dd_col_obj) {
   Read(&dd_name_, dd_col_obj, "name");
   ReadEnum(&dd_type_, dd_col_obj, "type");
@@ -62,9 +85,16 @@ bool Column::Init(const rapidjson::Value& dd_col_obj) {
       "secondary_engine_attribute");
   ReadEnum(&dd_column_key_, dd_col_obj, "column_key");
   Read(&dd_column_type_utf8_, dd_col_obj, "column_type_utf8");
-  // TODO(Zhao): dd_elements_
   if (dd_col_obj.HasMember("elements") && dd_col_obj["elements"].IsArray()) {
-    dd_elements_size_tmp_ = dd_col_obj["elements"].GetArray().Size();
+    for (const auto& element : dd_col_obj["elements"].GetArray()) {
+      std::string name;
+      if (element.IsObject() && element.HasMember("name") &&
+          element["name"].IsString()) {
+        // The names are serialized in base64
+        name = Base64Decode(element["name"].GetString());
+      }
+      dd_elements_.push_back(name);
+    }
   }
   Read(&dd_collation_id_, dd_col_obj, "collation_id");
   Read(&dd_is_explicit_collation_, dd_col_obj, "is_explicit_collation");
@@ -76,6 +106,7 @@ bool Column::Init(const rapidjson::Value& dd_col_obj) {
     is_array_ = (is_array_val != 0);
   }
 
+  decoder_ = SelectFieldDecoder(this);
   return true;
 }
 
@@ -476,9 +507,7 @@ uint32_t Column::FieldType2SeType() const {
   return 0;
 }
 
-#define DIG_PER_DEC1 9
 #define PORTABLE_SIZEOF_CHAR_PTR 8
-static const int dig2bytes[DIG_PER_DEC1 + 1] = {0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
 
 uint32_t Column::PackLength() const {
   switch (DDType2FieldType(dd_type_)) {
@@ -506,9 +535,9 @@ uint32_t Column::PackLength() const {
     case MYSQL_TYPE_VECTOR:
       return 4 + PORTABLE_SIZEOF_CHAR_PTR;
     case MYSQL_TYPE_ENUM:
-      return dd_elements_size_tmp_ < 256 ? 1 : 2;
+      return dd_elements_.size() < 256 ? 1 : 2;
     case MYSQL_TYPE_SET: {
-      uint64_t len = (dd_elements_size_tmp_ + 7) / 8;
+      uint64_t len = (dd_elements_.size() + 7) / 8;
       return len > 4 ? 8 : len;
       }
       [[fallthrough]];
@@ -578,6 +607,14 @@ uint32_t Column::PackLength() const {
   }
 }
 
+std::string Column::CollationName() const {
+  auto iter = g_collation_map.find(dd_collation_id_);
+  if (iter == g_collation_map.end()) {
+    return "";
+  }
+  return iter->second.name;
+}
+
 bool Column::IsBinary() const {
   switch (FieldType()) {
     // For Field_str
@@ -599,6 +636,21 @@ bool Column::IsBinary() const {
   }
 }
 
+bool Column::IsCharacterString() const {
+  switch (FieldType()) {
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+    case MYSQL_TYPE_BLOB:
+      return !IsBinary();
+    default:
+      return false;
+  }
+}
+
 bool Column::IsColumnAdded() const {
   if (dd_se_private_data_.Exists("version_added")) {
     return true;
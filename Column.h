@@ -6,6 +6,7 @@
 
 #include "ibdUtils.h"
 #include "Properties.h"
+#include "FieldValue.h"
 
 #include <rapidjson/document.h>
 
@@ -30,6 +31,7 @@ class Column {
          ib_phy_pos_(UINT32_UNDEFINED),
          se_explicit_(true),
          index_column_(nullptr) {
+    decoder_ = SelectFieldDecoder(this);
   }
   // Only used in creating FTS_DOC_ID column
   Column(std::string name, uint32_t ind, bool fts) :
@@ -42,6 +44,7 @@ class Column {
          se_explicit_(true),
          index_column_(nullptr) {
            assert(fts);
+    decoder_ = SelectFieldDecoder(this);
   }
   void DebugDump(int space = 0) {
     std::string space_str(space, ' ');
@@ -114,8 +117,8 @@ class Column {
               << dd_column_key_ << std::endl
               << space_str << "  " << "column_type_utf8: "
               << dd_column_type_utf8_ << std::endl
-              // TODO(Zhao):
-              // dd_elements_
+              << space_str << "  " << "elements: "
+              << dd_elements_.size() << std::endl
               << space_str << "  " << "collation_id: "
               << dd_collation_id_ << std::endl
               << space_str << "  " << "is_explicit_collation: "
@@ -223,10 +226,30 @@ class Column {
   // Only used in setting SE DB_TRX_ID column type
   void set_type(enum_column_types type) {
     dd_type_ = type;
+    decoder_ = SelectFieldDecoder(this);
   }
   bool is_nullable() const {
     return dd_is_nullable_;
   }
+  bool is_unsigned() const {
+    return dd_is_unsigned_;
+  }
+  uint32_t char_length() const {
+    return dd_char_length_;
+  }
+  uint32_t numeric_precision() const {
+    return dd_numeric_precision_;
+  }
+  uint32_t numeric_scale() const {
+    return dd_numeric_scale_;
+  }
+  uint32_t datetime_precision() const {
+    return dd_datetime_precision_;
+  }
+  // Names of the ENUM or SET elements
+  const std::vector<std::string>& elements() const {
+    return dd_elements_;
+  }
   bool is_virtual() const {
     return dd_is_virtual_;
   }
@@ -247,6 +270,11 @@ class Column {
   static enum_field_types DDType2FieldType(enum_column_types);
   enum_field_types FieldType() const;
   bool IsBinary() const;
+  // Name of the collation, e.g. utf8mb4_0900_ai_ci, empty if unknown
+  std::string CollationName() const;
+  // Whether the values are text sorted by the collation: CHAR, VARCHAR and
+  // TEXT columns of a character set
+  bool IsCharacterString() const;
   uint32_t PackLength() const;
   static uint32_t VarcharLenBytes(uint32_t char_length) {
     return ((char_length) < 256 ? 1 : 2);
@@ -328,13 +356,27 @@ class Column {
   bool ib_instant_default() {
     return ib_instant_default_;
   }
+  // The stored bytes of the default value of an instantly added column,
+  // used for the rows inserted before the column was added
+  const std::string& ib_instant_default_value() const {
+    return ib_instant_default_value_;
+  }
+  void set_ib_instant_default_value(const std::string& value) {
+    ib_instant_default_value_ = value;
+  }
   bool is_array() const {
     return is_array_;
   }
-  bool se_explicit() {
+  bool se_explicit() const {
     return se_explicit_;
   }
 
+  // Decodes a stored value of this column, see FieldValue
+  bool Decode(const unsigned char* data, uint32_t len,
+              FieldValue* value) const {
+    return decoder_(this, data, len, value);
+  }
+
   uint32_t GetFixedSize();
   bool IsDroppedInOrBefore(uint8_t version) const;
   bool IsAddedAfter(uint8_t version) const;
@@ -379,9 +421,7 @@ class Column {
   std::string dd_secondary_engine_attribute_;
   enum_column_key dd_column_key_;
   std::string dd_column_type_utf8_;
-  // TODO(Zhao):
-  // Column_type_element_collection dd_elements_;
-  uint64_t dd_elements_size_tmp_;
+  std::vector<std::string> dd_elements_;
   uint64_t dd_collation_id_;
   bool dd_is_explicit_collation_;
 
@@ -394,10 +434,12 @@ class Column {
   uint32_t ib_phy_pos_;
   uint32_t ib_col_len_;
   bool ib_instant_default_;
+  std::string ib_instant_default_value_;
   bool is_array_ = false;
 
   bool se_explicit_;
   IndexColumn* index_column_;
+  FieldDecoder decoder_;
 };
 
 class IndexColumn {
@@ -440,6 +482,9 @@ class IndexColumn {
   bool hidden() const {
     return dd_hidden_;
   }
+  bool IsDescending() const {
+    return dd_order_ == ORDER_DESC;
+  }
   uint32_t ib_fixed_len() {
     return ib_fixed_len_;
   }
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "Datadir.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+namespace ibd_ninja {
+
+#define ninja_error(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][ERROR]: " fmt "\n", ##__VA_ARGS__)
+#define ninja_warn(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][WARN]: " fmt "\n", ##__VA_ARGS__)
+
+Datadir::Datadir(const std::string& path, uint32_t n_threads,
+                 uint32_t io_depth)
+  : path_(path), n_threads_(n_threads == 0 ? 1 : n_threads),
+    io_depth_(io_depth == 0 ? 1 : io_depth), next_file_(0),
+    n_open_files_(0), n_loaded_files_(0), n_failed_files_(0),
+    n_indexes_(0), n_failed_indexes_(0) {
+  while (path_.size() > 1 && path_.back() == '/') {
+    path_.pop_back();
+  }
+  max_open_files_ = 2 * n_threads_;
+}
+
+bool Datadir::DiscoverFiles(const std::string& dir) {
+  DIR* dirp = opendir(dir.c_str());
+  if (dirp == nullptr) {
+    ninja_error("Failed to open directory: %s, error: %d(%s)",
+                dir.c_str(), errno, strerror(errno));
+    return false;
+  }
+  std::vector<std::string> sub_dirs;
+  struct dirent* entry = nullptr;
+  while ((entry = readdir(dirp)) != nullptr) {
+    std::string name(entry->d_name);
+    if (name == "." || name == "..") {
+      continue;
+    }
+    std::string path = dir + "/" + name;
+    struct stat stat_info;
+    // Symbolic links to directories are not followed to avoid cycles
+    if (lstat(path.c_str(), &stat_info) != 0) {
+      continue;
+    }
+    if (S_ISDIR(stat_info.st_mode)) {
+      sub_dirs.push_back(path);
+      continue;
+    }
+    if (S_ISLNK(stat_info.st_mode) &&
+        (stat(path.c_str(), &stat_info) != 0 ||
+         !S_ISREG(stat_info.st_mode))) {
+      continue;
+    }
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ibd") == 0) {
+      files_.push_back(path);
+    }
+  }
+  closedir(dirp);
+  for (auto& sub_dir : sub_dirs) {
+    DiscoverFiles(sub_dir);
+  }
+  return true;
+}
+
+bool Datadir::Analyze() {
+  if (!DiscoverFiles(path_)) {
+    return false;
+  }
+  std::sort(files_.begin(), files_.end());
+  fprintf(stdout, "[ibdNinja]: Found %zu ibd files in %s, analyzing them "
+                  "with %u threads...\n",
+                  files_.size(), path_.c_str(), n_threads_);
+  fflush(stdout);
+
+  std::vector<std::thread> workers;
+  for (uint32_t i = 0; i < n_threads_; i++) {
+    workers.emplace_back(&Datadir::Worker, this);
+  }
+  for (auto& t : workers) {
+    t.join();
+  }
+  assert(n_open_files_ == 0 && index_jobs_.empty());
+
+  PrintReport();
+  return true;
+}
+
+void Datadir::Worker() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    // Finishing the files already loaded comes first, so that at most
+    // max_open_files_ tablespaces are open at a time
+    cond_.wait(lock, [this] {
+      return !index_jobs_.empty() ||
+             (next_file_ < files_.size() &&
+              n_open_files_ < max_open_files_) ||
+             (next_file_ == files_.size() && n_open_files_ == 0);
+    });
+    if (!index_jobs_.empty()) {
+      IndexJob job = index_jobs_.front();
+      index_jobs_.pop_front();
+      lock.unlock();
+      AnalyzeIndex(job);
+      lock.lock();
+      if (--job.file->n_pending == 0) {
+        FinishFile(job.file);
+      }
+    } else if (next_file_ < files_.size()) {
+      size_t file_no = next_file_++;
+      n_open_files_++;
+      lock.unlock();
+      LoadFile(file_no);
+      lock.lock();
+    } else {
+      cond_.notify_all();
+      return;
+    }
+  }
+}
+
+void Datadir::LoadFile(size_t file_no) {
+  FileContext* file = new FileContext();
+  file->path = files_[file_no];
+  file->ninja = ibdNinja::CreateNinja(file->path.c_str(), false);
+
+  std::vector<IndexJob> jobs;
+  if (file->ninja != nullptr) {
+    file->ninja->set_io_depth(std::max<uint32_t>(1, io_depth_ / n_threads_));
+    std::string rel_path = file->path.substr(path_.size() + 1);
+    for (auto& iter : *file->ninja->tables()) {
+      Table* table = iter.second;
+      for (auto index : table->indexes()) {
+        if (!index->IsIndexParsingRecSupported() ||
+            file->ninja->indexes()->find(index->ib_id()) ==
+            file->ninja->indexes()->end()) {
+          continue;
+        }
+        TableResult& result = file->tables[iter.first];
+        if (result.name.empty()) {
+          result.file = rel_path;
+          result.name = table->schema_ref() + "." + table->name();
+        }
+        jobs.push_back({file, iter.first, index});
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file->ninja != nullptr) {
+    n_loaded_files_++;
+  } else {
+    n_failed_files_++;
+  }
+  file->n_pending = jobs.size();
+  if (jobs.empty()) {
+    FinishFile(file);
+    return;
+  }
+  index_jobs_.insert(index_jobs_.end(), jobs.begin(), jobs.end());
+  cond_.notify_all();
+}
+
+void Datadir::AnalyzeIndex(const IndexJob& job) {
+  IndexAnalyzeResult index_result;
+  bool ret = job.file->ninja->AnalyzeIndex(job.index, &index_result, false);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  TableResult& result = job.file->tables[job.table_id];
+  n_indexes_++;
+  result.n_indexes++;
+  if (!ret) {
+    ninja_warn("Failed to analyze index %s of table %s in %s",
+               job.index->name().c_str(), result.name.c_str(),
+               job.file->path.c_str());
+    n_failed_indexes_++;
+    result.n_failed_indexes++;
+    return;
+  }
+  const PageAnalysisResult& recs = index_result.recs_result;
+  result.pages_size += (index_result.n_pages_leaf +
+                        index_result.n_pages_non_leaf) *
+                       job.file->ninja->space()->page_physical_size();
+  result.valid_recs_size += recs.headers_len_leaf + recs.recs_len_leaf +
+                            recs.headers_len_non_leaf +
+                            recs.recs_len_non_leaf;
+  result.deleted_recs_size += recs.deleted_recs_len_leaf +
+                              recs.deleted_recs_len_non_leaf;
+  result.dropped_cols_size += recs.dropped_cols_len_leaf +
+                              recs.dropped_cols_len_non_leaf;
+  result.free_size += recs.free_leaf + recs.free_non_leaf;
+  result.n_pages_read += index_result.n_pages_read;
+}
+
+// Called with mutex_ held
+void Datadir::FinishFile(FileContext* file) {
+  for (auto& iter : file->tables) {
+    results_.push_back(iter.second);
+  }
+  delete file->ninja;
+  delete file;
+  n_open_files_--;
+  cond_.notify_all();
+}
+
+void Datadir::PrintReport() {
+  std::sort(results_.begin(), results_.end(),
+            [](const TableResult& a, const TableResult& b) {
+              if (a.wasted_size() != b.wasted_size()) {
+                return a.wasted_size() > b.wasted_size();
+              }
+              if (a.name != b.name) {
+                return a.name < b.name;
+              }
+              return a.file < b.file;
+            });
+  TableResult total;
+  for (auto& result : results_) {
+    total.pages_size += result.pages_size;
+    total.valid_recs_size += result.valid_recs_size;
+    total.deleted_recs_size += result.deleted_recs_size;
+    total.dropped_cols_size += result.dropped_cols_size;
+    total.free_size += result.free_size;
+    total.n_pages_read += result.n_pages_read;
+  }
+  fprintf(stdout, "=========================================="
+                  "==========================================\n");
+  fprintf(stdout, "|  DATADIR ANALYSIS RESULT                 "
+                  "                                         |\n");
+  fprintf(stdout, "------------------------------------------"
+                  "------------------------------------------\n");
+  fprintf(stdout, "Datadir:                                          %s\n",
+                   path_.c_str());
+  fprintf(stdout, "Num of ibd files:                                 %zu\n"
+                  "                                                  "
+                  "  [Loaded: %u]\n"
+                  "                                                  "
+                  "  [Failed: %u]\n",
+                   files_.size(), n_loaded_files_, n_failed_files_);
+  fprintf(stdout, "Num of tables analyzed:                           %zu\n",
+                   results_.size());
+  fprintf(stdout, "Num of indexes analyzed:                          %u\n"
+                  "                                                  "
+                  "  [Failed: %u]\n",
+                   n_indexes_, n_failed_indexes_);
+  fprintf(stdout, "Num of page reads:                                "
+                  "%" PRIu64 "\n",
+                   total.n_pages_read);
+  fprintf(stdout, "Total pages size:                                 "
+                  "%" PRIu64 " B\n",
+                   total.pages_size);
+  fprintf(stdout, "Total valid records size:                         "
+                  "%" PRIu64 " B\n",
+                   total.valid_recs_size);
+  fprintf(stdout, "Total wasted space:                               "
+                  "%" PRIu64 " B\n"
+                  "                                                  "
+                  "  [Delete-marked records: %" PRIu64 " B]\n"
+                  "                                                  "
+                  "  [Dropped columns:       %" PRIu64 " B]\n"
+                  "                                                  "
+                  "  [Free space:            %" PRIu64 " B]\n",
+                   total.wasted_size(), total.deleted_recs_size,
+                   total.dropped_cols_size, total.free_size);
+  fprintf(stdout, "Wasted space ratio:                               "
+                  "%02.05lf %%\n",
+                   Ratio(total.wasted_size(), total.pages_size));
+
+  fprintf(stdout, "\n--------TABLES-BY-WASTED-SPACE--\n");
+  fprintf(stdout, "%14s %10s %14s %14s %14s %14s  %s\n",
+                  "Wasted(B)", "Wasted(%)", "Pages(B)", "Deleted(B)",
+                  "Dropped(B)", "Free(B)", "Table");
+  for (auto& result : results_) {
+    fprintf(stdout, "%14" PRIu64 " %10.05lf %14" PRIu64 " %14" PRIu64
+                    " %14" PRIu64 " %14" PRIu64 "  %s (%s)%s\n",
+                    result.wasted_size(),
+                    Ratio(result.wasted_size(), result.pages_size),
+                    result.pages_size, result.deleted_recs_size,
+                    result.dropped_cols_size, result.free_size,
+                    result.name.c_str(), result.file.c_str(),
+                    result.n_failed_indexes > 0 ? " [incomplete]" : "");
+  }
+}
+
+}  // namespace ibd_ninja
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef DATADIR_H_
+#define DATADIR_H_
+
+#include "ibdNinja.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ibd_ninja {
+
+// Analyzes all .ibd files found under a directory in one process. A bounded
+// pool of worker threads loads the SDI of each file and analyzes the indexes
+// of every file concurrently, then one report of all tables sorted by wasted
+// space is printed.
+class Datadir {
+ public:
+  // io_depth is the number of page reads kept in flight by all workers
+  // together
+  Datadir(const std::string& path, uint32_t n_threads, uint32_t io_depth);
+
+  bool Analyze();
+
+ private:
+  struct TableResult {
+    std::string file;
+    std::string name;
+    uint32_t n_indexes = 0;
+    uint32_t n_failed_indexes = 0;
+    uint64_t pages_size = 0;
+    uint64_t valid_recs_size = 0;
+    uint64_t deleted_recs_size = 0;
+    uint64_t dropped_cols_size = 0;
+    uint64_t free_size = 0;
+    uint64_t n_pages_read = 0;
+    uint64_t wasted_size() const {
+      return deleted_recs_size + dropped_cols_size + free_size;
+    }
+  };
+  // A loaded file whose indexes are being analyzed, the ninja is released
+  // once the last of them is done
+  struct FileContext {
+    std::string path;
+    ibdNinja* ninja = nullptr;
+    uint32_t n_pending = 0;
+    std::map<uint64_t, TableResult> tables;
+  };
+  struct IndexJob {
+    FileContext* file;
+    uint64_t table_id;
+    Index* index;
+  };
+
+  bool DiscoverFiles(const std::string& dir);
+  void Worker();
+  void LoadFile(size_t file_no);
+  void AnalyzeIndex(const IndexJob& job);
+  void FinishFile(FileContext* file);
+  void PrintReport();
+
+  std::string path_;
+  uint32_t n_threads_;
+  uint32_t io_depth_;
+  std::vector<std::string> files_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  // Index in files_ of the next file to be loaded
+  size_t next_file_;
+  // Files loaded and not finished yet, bounded to limit the memory and the
+  // file descriptors in use
+  uint32_t n_open_files_;
+  uint32_t max_open_files_;
+  std::deque<IndexJob> index_jobs_;
+
+  std::vector<TableResult> results_;
+  uint32_t n_loaded_files_;
+  uint32_t n_failed_files_;
+  uint32_t n_indexes_;
+  uint32_t n_failed_indexes_;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // DATADIR_H_
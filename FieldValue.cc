@@ -0,0 +1,870 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "FieldValue.h"
+#include "Column.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace ibd_ninja {
+
+static const uint32_t kPowersOf10[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// TIME2 and DATETIME2 are stored with these offsets added, and are decoded
+// to the packed format of MySQL: the integer part shifted by 24 bits plus
+// the microseconds
+constexpr int64_t TIMEF_INT_OFS = 0x800000LL;
+constexpr int64_t TIMEF_OFS = 0x800000000000LL;
+constexpr int64_t DATETIMEF_INT_OFS = 0x8000000000LL;
+constexpr int64_t PACKED_TIME_FRAC_RANGE = 1LL << 24;
+
+static uint64_t ReadBigEndian(const unsigned char* data, uint32_t len) {
+  uint64_t v = 0;
+  for (uint32_t n = 0; n < len; n++) {
+    v = (v << 8) | data[n];
+  }
+  return v;
+}
+
+static uint64_t ReadLittleEndian(const unsigned char* data, uint32_t len) {
+  uint64_t v = 0;
+  for (uint32_t n = len; n > 0; n--) {
+    v = (v << 8) | data[n - 1];
+  }
+  return v;
+}
+
+static int64_t SignExtend(uint64_t v, uint32_t len) {
+  uint32_t bits = len * 8;
+  if (bits < 64 && (v & (1ULL << (bits - 1)))) {
+    v |= ~0ULL << bits;
+  }
+  return static_cast<int64_t>(v);
+}
+
+// Signed integers are stored big-endian with the sign bit flipped, so that
+// they compare as unsigned bytes
+static int64_t ReadSignedBigEndian(const unsigned char* data, uint32_t len) {
+  return SignExtend(ReadBigEndian(data, len) ^ (1ULL << (len * 8 - 1)),
+                    len);
+}
+
+static uint32_t TextLength(int n, uint32_t size) {
+  if (n < 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(n) < size ? n : size - 1;
+}
+
+// Values formatted into buf, text that outgrows it continues in long_text
+static void StartText(FieldValue* value) {
+  value->kind = FieldValue::STRING;
+  value->str = value->buf;
+  value->len = 0;
+  value->buf[0] = '\0';
+}
+
+static void AppendText(FieldValue* value, const char* fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+static void AppendText(FieldValue* value, const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  va_list ap_long;
+  va_copy(ap_long, ap);
+  int n = 0;
+  if (value->str == value->buf) {
+    uint32_t avail = FieldValue::kBufSize - value->len;
+    n = vsnprintf(value->buf + value->len, avail, fmt, ap);
+    if (n < 0 || static_cast<uint32_t>(n) < avail) {
+      value->len += TextLength(n, avail);
+      va_end(ap_long);
+      va_end(ap);
+      return;
+    }
+    value->long_text.assign(value->buf, value->len);
+  } else {
+    n = vsnprintf(nullptr, 0, fmt, ap);
+  }
+  if (n > 0) {
+    size_t offs = value->long_text.size();
+    value->long_text.resize(offs + n);
+    vsnprintf(&value->long_text[offs], n + 1, fmt, ap_long);
+  }
+  va_end(ap_long);
+  va_end(ap);
+  value->str = value->long_text.data();
+  value->len = value->long_text.size();
+}
+
+static void AppendFraction(FieldValue* value, uint32_t usec, uint32_t dec) {
+  if (dec > 0) {
+    AppendText(value, ".%0*u", static_cast<int>(dec),
+               usec / kPowersOf10[6 - dec]);
+  }
+}
+
+float FieldValue::vector_element(uint32_t n) const {
+  uint32_t bits = static_cast<uint32_t>(ReadLittleEndian(
+      reinterpret_cast<const unsigned char*>(str) + n * sizeof(float),
+      sizeof(float)));
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+uint32_t FormatFloat(float f, char* buf, uint32_t size) {
+  int n = snprintf(buf, size, "%.6g", f);
+  if (strtof(buf, nullptr) != f) {
+    n = snprintf(buf, size, "%.9g", f);
+  }
+  return TextLength(n, size);
+}
+
+uint32_t FormatDouble(double d, char* buf, uint32_t size) {
+  int n = snprintf(buf, size, "%.15g", d);
+  if (strtod(buf, nullptr) != d) {
+    n = snprintf(buf, size, "%.17g", d);
+  }
+  return TextLength(n, size);
+}
+
+bool CompareNumber(const FieldValue& value, long double number, int* cmp) {
+  long double v = 0;
+  switch (value.kind) {
+    case FieldValue::INT:
+      v = value.i;
+      break;
+    case FieldValue::UINT:
+      v = value.u;
+      break;
+    case FieldValue::FLOAT:
+    case FieldValue::DOUBLE:
+      if (std::isnan(value.d)) {
+        return false;
+      }
+      v = value.d;
+      if (value.kind == FieldValue::FLOAT) {
+        number = static_cast<float>(number);
+      } else {
+        number = static_cast<double>(number);
+      }
+      break;
+    default:
+      return false;
+  }
+  *cmp = v < number ? -1 : (v > number ? 1 : 0);
+  return true;
+}
+
+// The digits of a decimal number without exponent, the integer part
+// without its leading zeros and the fraction without its trailing zeros
+struct DecimalParts {
+  bool negative = false;
+  const char* int_digits = nullptr;
+  size_t int_len = 0;
+  const char* frac_digits = nullptr;
+  size_t frac_len = 0;
+};
+
+// Old DECIMAL values are stored as text padded with leading spaces
+static bool SplitDecimal(const char* str, size_t len, DecimalParts* parts) {
+  size_t i = 0;
+  while (i < len && str[i] == ' ') {
+    i++;
+  }
+  if (i < len && (str[i] == '-' || str[i] == '+')) {
+    parts->negative = (str[i] == '-');
+    i++;
+  }
+  size_t int_begin = i;
+  while (i < len && isdigit(static_cast<unsigned char>(str[i]))) {
+    i++;
+  }
+  size_t int_end = i;
+  size_t frac_begin = i;
+  if (i < len && str[i] == '.') {
+    frac_begin = ++i;
+    while (i < len && isdigit(static_cast<unsigned char>(str[i]))) {
+      i++;
+    }
+  }
+  size_t frac_end = i;
+  if (i != len || (int_end == int_begin && frac_end == frac_begin)) {
+    return false;
+  }
+  while (int_begin < int_end && str[int_begin] == '0') {
+    int_begin++;
+  }
+  while (frac_end > frac_begin && str[frac_end - 1] == '0') {
+    frac_end--;
+  }
+  parts->int_digits = str + int_begin;
+  parts->int_len = int_end - int_begin;
+  parts->frac_digits = str + frac_begin;
+  parts->frac_len = frac_end - frac_begin;
+  if (parts->int_len == 0 && parts->frac_len == 0) {
+    // -0 is 0
+    parts->negative = false;
+  }
+  return true;
+}
+
+bool NormalizeDecimal(const std::string& text, std::string* digits) {
+  // Far more than the 65 digits of a DECIMAL, but keeps the digits of a
+  // literal such as 1e999999999 to a sane length
+  static const long kMaxExponent = 1000;
+  size_t mantissa_len = text.find_first_of("eE");
+  long exponent = 0;
+  if (mantissa_len != std::string::npos) {
+    const char* start = text.c_str() + mantissa_len + 1;
+    const char* p = start;
+    if (*p == '-' || *p == '+') {
+      p++;
+    }
+    if (!isdigit(static_cast<unsigned char>(*p))) {
+      return false;
+    }
+    for (; isdigit(static_cast<unsigned char>(*p)); p++) {
+      exponent = exponent * 10 + (*p - '0');
+      if (exponent > kMaxExponent) {
+        return false;
+      }
+    }
+    if (*p != '\0') {
+      return false;
+    }
+    if (*start == '-') {
+      exponent = -exponent;
+    }
+  } else {
+    mantissa_len = text.size();
+  }
+  DecimalParts parts;
+  if (!SplitDecimal(text.data(), mantissa_len, &parts)) {
+    return false;
+  }
+  // Moves the point of the digits by the exponent
+  std::string all(parts.int_digits, parts.int_len);
+  all.append(parts.frac_digits, parts.frac_len);
+  long shifted = static_cast<long>(parts.int_len) + exponent;
+  if (shifted < 0) {
+    all.insert(0, -shifted, '0');
+    shifted = 0;
+  }
+  size_t point = shifted;
+  if (point > all.size()) {
+    all.append(point - all.size(), '0');
+  }
+  size_t int_begin = std::min(all.find_first_not_of('0'), point);
+  size_t frac_end = all.find_last_not_of('0');
+  if (frac_end == std::string::npos || frac_end < point) {
+    frac_end = point;
+  } else {
+    frac_end++;
+  }
+  digits->clear();
+  if (parts.negative) {
+    digits->push_back('-');
+  }
+  if (int_begin == point) {
+    digits->push_back('0');
+  } else {
+    digits->append(all, int_begin, point - int_begin);
+  }
+  if (frac_end > point) {
+    digits->push_back('.');
+    digits->append(all, point, frac_end - point);
+  }
+  return true;
+}
+
+bool CompareDecimal(const FieldValue& value, const std::string& digits,
+                    int* cmp) {
+  DecimalParts a;
+  DecimalParts b;
+  if (value.kind != FieldValue::STRING ||
+      !SplitDecimal(value.str, value.len, &a) ||
+      !SplitDecimal(digits.data(), digits.size(), &b)) {
+    return false;
+  }
+  if (a.negative != b.negative) {
+    *cmp = a.negative ? -1 : 1;
+    return true;
+  }
+  // Magnitudes first, by the number of integer digits, then digit by digit
+  int magnitude = 0;
+  if (a.int_len != b.int_len) {
+    magnitude = a.int_len < b.int_len ? -1 : 1;
+  } else {
+    magnitude = memcmp(a.int_digits, b.int_digits, a.int_len);
+    if (magnitude == 0) {
+      size_t frac_len = std::min(a.frac_len, b.frac_len);
+      magnitude = memcmp(a.frac_digits, b.frac_digits, frac_len);
+      if (magnitude == 0 && a.frac_len != b.frac_len) {
+        magnitude = a.frac_len < b.frac_len ? -1 : 1;
+      }
+    }
+  }
+  magnitude = magnitude < 0 ? -1 : (magnitude > 0 ? 1 : 0);
+  *cmp = a.negative ? -magnitude : magnitude;
+  return true;
+}
+
+uint32_t FormatNumber(const FieldValue& value, char* buf, uint32_t size) {
+  switch (value.kind) {
+    case FieldValue::INT:
+      return TextLength(snprintf(buf, size, "%" PRId64, value.i), size);
+    case FieldValue::UINT:
+      return TextLength(snprintf(buf, size, "%" PRIu64, value.u), size);
+    case FieldValue::FLOAT:
+      return FormatFloat(static_cast<float>(value.d), buf, size);
+    case FieldValue::DOUBLE:
+      return FormatDouble(value.d, buf, size);
+    default:
+      return 0;
+  }
+}
+
+/* ------ Decoders ------ */
+static bool DecodeNone(const Column* /* col */,
+                       const unsigned char* /* data */, uint32_t /* len */,
+                       FieldValue* /* value */) {
+  return false;
+}
+
+static bool DecodeSigned(const Column* /* col */, const unsigned char* data,
+                         uint32_t len, FieldValue* value) {
+  if (len == 0 || len > 8) {
+    return false;
+  }
+  value->kind = FieldValue::INT;
+  value->i = ReadSignedBigEndian(data, len);
+  return true;
+}
+
+// Also used for BIT and the system columns
+static bool DecodeUnsigned(const Column* /* col */,
+                           const unsigned char* data, uint32_t len,
+                           FieldValue* value) {
+  if (len == 0 || len > 8) {
+    return false;
+  }
+  value->kind = FieldValue::UINT;
+  value->u = ReadBigEndian(data, len);
+  return true;
+}
+
+// FLOAT and DOUBLE are stored little-endian
+static bool DecodeFloat(const Column* /* col */, const unsigned char* data,
+                        uint32_t len, FieldValue* value) {
+  if (len != sizeof(float)) {
+    return false;
+  }
+  uint32_t bits = static_cast<uint32_t>(ReadLittleEndian(data, len));
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  value->kind = FieldValue::FLOAT;
+  value->d = f;
+  return true;
+}
+
+static bool DecodeDouble(const Column* /* col */, const unsigned char* data,
+                         uint32_t len, FieldValue* value) {
+  if (len != sizeof(double)) {
+    return false;
+  }
+  uint64_t bits = ReadLittleEndian(data, len);
+  value->kind = FieldValue::DOUBLE;
+  memcpy(&value->d, &bits, sizeof(value->d));
+  return true;
+}
+
+// The integer and fractional digits are stored in groups of 9 digits per
+// 4 bytes, the leftmost integer group and the rightmost fractional group
+// may be shorter (see dig2bytes). The sign bit is flipped, and all bits of
+// a negative value are inverted.
+static bool DecodeNewDecimal(const Column* col, const unsigned char* data,
+                             uint32_t len, FieldValue* value) {
+  int precision = static_cast<int>(col->numeric_precision());
+  int scale = static_cast<int>(col->numeric_scale());
+  if (precision <= 0 || scale < 0 || scale > precision) {
+    return false;
+  }
+  int intg = precision - scale;
+  int intg0 = intg / DIG_PER_DEC1;
+  int intg0x = intg % DIG_PER_DEC1;
+  int frac0 = scale / DIG_PER_DEC1;
+  int frac0x = scale % DIG_PER_DEC1;
+  uint32_t size = intg0 * sizeof(int32_t) + dig2bytes[intg0x] +
+                  frac0 * sizeof(int32_t) + dig2bytes[frac0x];
+  // 65 digits take at most 30 bytes
+  unsigned char bytes[32];
+  if (len != size || size > sizeof(bytes)) {
+    return false;
+  }
+  unsigned char mask = (data[0] & 0x80) ? 0 : 0xFF;
+  for (uint32_t n = 0; n < size; n++) {
+    bytes[n] = data[n] ^ mask;
+  }
+  bytes[0] ^= 0x80;
+
+  StartText(value);
+  if (mask != 0) {
+    AppendText(value, "-");
+  }
+  const unsigned char* p = bytes;
+  bool has_int_digits = false;
+  uint32_t word = 0;
+  if (intg0x > 0) {
+    word = ReadBigEndian(p, dig2bytes[intg0x]);
+    p += dig2bytes[intg0x];
+    if (word >= kPowersOf10[intg0x]) {
+      return false;
+    }
+    if (word != 0) {
+      AppendText(value, "%u", word);
+      has_int_digits = true;
+    }
+  }
+  for (int n = 0; n < intg0; n++) {
+    word = ReadBigEndian(p, sizeof(int32_t));
+    p += sizeof(int32_t);
+    if (word >= kPowersOf10[DIG_PER_DEC1]) {
+      return false;
+    }
+    if (has_int_digits) {
+      AppendText(value, "%09u", word);
+    } else if (word != 0) {
+      AppendText(value, "%u", word);
+      has_int_digits = true;
+    }
+  }
+  if (!has_int_digits) {
+    AppendText(value, "0");
+  }
+  if (scale == 0) {
+    return true;
+  }
+  AppendText(value, ".");
+  for (int n = 0; n < frac0; n++) {
+    word = ReadBigEndian(p, sizeof(int32_t));
+    p += sizeof(int32_t);
+    if (word >= kPowersOf10[DIG_PER_DEC1]) {
+      return false;
+    }
+    AppendText(value, "%09u", word);
+  }
+  if (frac0x > 0) {
+    word = ReadBigEndian(p, dig2bytes[frac0x]);
+    if (word >= kPowersOf10[frac0x]) {
+      return false;
+    }
+    AppendText(value, "%0*u", frac0x, word);
+  }
+  return true;
+}
+
+// Character data in the column charset, as stored
+static bool DecodeText(const Column* /* col */, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  value->kind = FieldValue::STRING;
+  value->str = reinterpret_cast<const char*>(data);
+  value->len = len;
+  return true;
+}
+
+// CHAR is padded with spaces, which are not part of the value
+static bool DecodeChar(const Column* col, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  while (len > 0 && data[len - 1] == ' ') {
+    len--;
+  }
+  return DecodeText(col, data, len, value);
+}
+
+static bool DecodeBinary(const Column* /* col */, const unsigned char* data,
+                         uint32_t len, FieldValue* value) {
+  value->kind = FieldValue::BINARY;
+  value->str = reinterpret_cast<const char*>(data);
+  value->len = len;
+  return true;
+}
+
+static bool DecodeJson(const Column* /* col */, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  if (len == 0) {
+    return false;
+  }
+  value->kind = FieldValue::JSON;
+  value->str = reinterpret_cast<const char*>(data);
+  value->len = len;
+  return true;
+}
+
+static bool DecodeVector(const Column* /* col */, const unsigned char* data,
+                         uint32_t len, FieldValue* value) {
+  if (len % sizeof(float) != 0) {
+    return false;
+  }
+  value->kind = FieldValue::VECTOR;
+  value->str = reinterpret_cast<const char*>(data);
+  value->len = len;
+  return true;
+}
+
+static bool DecodeYear(const Column* /* col */, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  if (len != 1) {
+    return false;
+  }
+  value->kind = FieldValue::UINT;
+  value->u = data[0] == 0 ? 0 : 1900 + data[0];
+  return true;
+}
+
+// 3 bytes: day (5 bits), month (4 bits) and year
+static bool DecodeDate(const Column* /* col */, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  if (len != 3) {
+    return false;
+  }
+  int64_t v = ReadSignedBigEndian(data, len);
+  if (v < 0) {
+    return false;
+  }
+  StartText(value);
+  AppendText(value, "%04u-%02u-%02u", static_cast<uint32_t>(v >> 9),
+             static_cast<uint32_t>((v >> 5) & 0xF),
+             static_cast<uint32_t>(v & 0x1F));
+  return true;
+}
+
+static bool DecodeTime2(const Column* col, const unsigned char* data,
+                        uint32_t len, FieldValue* value) {
+  uint32_t dec = col->datetime_precision();
+  if (dec > 6 || len != 3 + (dec + 1) / 2) {
+    return false;
+  }
+  int64_t int_part = ReadBigEndian(data, 3) - TIMEF_INT_OFS;
+  int64_t frac = 0;
+  int64_t packed = 0;
+  switch (dec) {
+    case 0:
+      packed = int_part * PACKED_TIME_FRAC_RANGE;
+      break;
+    case 1:
+    case 2:
+      frac = data[3];
+      if (int_part < 0 && frac != 0) {
+        int_part++;
+        frac -= 0x100;
+      }
+      packed = int_part * PACKED_TIME_FRAC_RANGE + frac * 10000;
+      break;
+    case 3:
+    case 4:
+      frac = ReadBigEndian(data + 3, 2);
+      if (int_part < 0 && frac != 0) {
+        int_part++;
+        frac -= 0x10000;
+      }
+      packed = int_part * PACKED_TIME_FRAC_RANGE + frac * 100;
+      break;
+    default:
+      packed = ReadBigEndian(data, 6) - TIMEF_OFS;
+      break;
+  }
+  bool neg = packed < 0;
+  uint64_t v = neg ? -packed : packed;
+  uint64_t hms = v / PACKED_TIME_FRAC_RANGE;
+  StartText(value);
+  AppendText(value, "%s%02u:%02u:%02u", neg ? "-" : "",
+             static_cast<uint32_t>((hms >> 12) & 0x3FF),
+             static_cast<uint32_t>((hms >> 6) & 0x3F),
+             static_cast<uint32_t>(hms & 0x3F));
+  AppendFraction(value, v % PACKED_TIME_FRAC_RANGE, dec);
+  return true;
+}
+
+static bool DecodeDatetime2(const Column* col, const unsigned char* data,
+                            uint32_t len, FieldValue* value) {
+  uint32_t dec = col->datetime_precision();
+  if (dec > 6 || len != 5 + (dec + 1) / 2) {
+    return false;
+  }
+  int64_t int_part = ReadBigEndian(data, 5) - DATETIMEF_INT_OFS;
+  int64_t frac = 0;
+  switch (dec) {
+    case 0:
+      break;
+    case 1:
+    case 2:
+      frac = SignExtend(data[5], 1) * 10000;
+      break;
+    case 3:
+    case 4:
+      frac = SignExtend(ReadBigEndian(data + 5, 2), 2) * 100;
+      break;
+    default:
+      frac = SignExtend(ReadBigEndian(data + 5, 3), 3);
+      break;
+  }
+  int64_t packed = int_part * PACKED_TIME_FRAC_RANGE + frac;
+  if (packed < 0) {
+    return false;
+  }
+  // year * 13 + month (17 bits), day (5 bits), hour (5 bits), minute and
+  // second (6 bits each)
+  uint64_t ymdhms = packed / PACKED_TIME_FRAC_RANGE;
+  uint64_t ymd = ymdhms >> 17;
+  uint64_t ym = ymd >> 5;
+  uint64_t hms = ymdhms & 0x1FFFF;
+  StartText(value);
+  AppendText(value, "%04u-%02u-%02u %02u:%02u:%02u",
+             static_cast<uint32_t>(ym / 13), static_cast<uint32_t>(ym % 13),
+             static_cast<uint32_t>(ymd & 0x1F),
+             static_cast<uint32_t>(hms >> 12),
+             static_cast<uint32_t>((hms >> 6) & 0x3F),
+             static_cast<uint32_t>(hms & 0x3F));
+  AppendFraction(value, packed % PACKED_TIME_FRAC_RANGE, dec);
+  return true;
+}
+
+// TIMESTAMP is stored in UTC as seconds since the epoch
+static void FormatTimestamp(FieldValue* value, uint64_t seconds,
+                            uint32_t usec, uint32_t dec) {
+  StartText(value);
+  if (seconds == 0) {
+    AppendText(value, "0000-00-00 00:00:00");
+  } else {
+    time_t t = static_cast<time_t>(seconds);
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    AppendText(value, "%04d-%02d-%02d %02d:%02d:%02d",
+               tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+               tm.tm_hour, tm.tm_min, tm.tm_sec);
+  }
+  AppendFraction(value, usec, dec);
+}
+
+static bool DecodeTimestamp2(const Column* col, const unsigned char* data,
+                             uint32_t len, FieldValue* value) {
+  uint32_t dec = col->datetime_precision();
+  if (dec > 6 || len != 4 + (dec + 1) / 2) {
+    return false;
+  }
+  uint32_t usec = 0;
+  switch (dec) {
+    case 0:
+      break;
+    case 1:
+    case 2:
+      usec = data[4] * 10000;
+      break;
+    case 3:
+    case 4:
+      usec = ReadBigEndian(data + 4, 2) * 100;
+      break;
+    default:
+      usec = ReadBigEndian(data + 4, 3);
+      break;
+  }
+  FormatTimestamp(value, ReadBigEndian(data, 4), usec, dec);
+  return true;
+}
+
+// The temporal types from before MySQL 5.6.4
+static bool DecodeOldTimestamp(const Column* /* col */,
+                               const unsigned char* data, uint32_t len,
+                               FieldValue* value) {
+  if (len != 4) {
+    return false;
+  }
+  FormatTimestamp(value, ReadBigEndian(data, 4), 0, 0);
+  return true;
+}
+
+// HHMMSS as a 3-byte integer
+static bool DecodeOldTime(const Column* /* col */, const unsigned char* data,
+                          uint32_t len, FieldValue* value) {
+  if (len != 3) {
+    return false;
+  }
+  int64_t v = ReadSignedBigEndian(data, len);
+  bool neg = v < 0;
+  uint64_t hms = neg ? -v : v;
+  StartText(value);
+  AppendText(value, "%s%02u:%02u:%02u", neg ? "-" : "",
+             static_cast<uint32_t>(hms / 10000),
+             static_cast<uint32_t>(hms / 100 % 100),
+             static_cast<uint32_t>(hms % 100));
+  return true;
+}
+
+// YYYYMMDDHHMMSS as an 8-byte integer
+static bool DecodeOldDatetime(const Column* /* col */,
+                              const unsigned char* data, uint32_t len,
+                              FieldValue* value) {
+  if (len != 8) {
+    return false;
+  }
+  int64_t v = ReadSignedBigEndian(data, len);
+  if (v < 0) {
+    return false;
+  }
+  uint64_t date = v / 1000000;
+  uint64_t time = v % 1000000;
+  StartText(value);
+  AppendText(value, "%04u-%02u-%02u %02u:%02u:%02u",
+             static_cast<uint32_t>(date / 10000),
+             static_cast<uint32_t>(date / 100 % 100),
+             static_cast<uint32_t>(date % 100),
+             static_cast<uint32_t>(time / 10000),
+             static_cast<uint32_t>(time / 100 % 100),
+             static_cast<uint32_t>(time % 100));
+  return true;
+}
+
+// 1-based index of the element, 0 for the empty error value
+static bool DecodeEnum(const Column* col, const unsigned char* data,
+                       uint32_t len, FieldValue* value) {
+  if (len == 0 || len > 2) {
+    return false;
+  }
+  uint64_t n = ReadBigEndian(data, len);
+  const std::vector<std::string>& elements = col->elements();
+  if (n > elements.size()) {
+    return false;
+  }
+  value->kind = FieldValue::STRING;
+  if (n == 0) {
+    value->str = value->buf;
+    value->len = 0;
+  } else {
+    value->str = elements[n - 1].data();
+    value->len = elements[n - 1].size();
+  }
+  return true;
+}
+
+// Bitmap of the elements
+static bool DecodeSet(const Column* col, const unsigned char* data,
+                      uint32_t len, FieldValue* value) {
+  if (len == 0 || len > 8) {
+    return false;
+  }
+  uint64_t bits = ReadBigEndian(data, len);
+  const std::vector<std::string>& elements = col->elements();
+  StartText(value);
+  for (size_t n = 0; n < elements.size() && n < 64; n++) {
+    if (bits & (1ULL << n)) {
+      AppendText(value, "%s%s", value->len > 0 ? "," : "",
+                 elements[n].c_str());
+    }
+  }
+  return true;
+}
+
+FieldDecoder SelectFieldDecoder(const Column* col) {
+  // DB_ROW_ID, DB_TRX_ID, DB_ROLL_PTR and FTS_DOC_ID
+  if (col->se_explicit() || col->IsSystemColumn()) {
+    return DecodeUnsigned;
+  }
+  switch (Column::DDType2FieldType(col->type())) {
+    case Column::MYSQL_TYPE_TINY:
+    case Column::MYSQL_TYPE_SHORT:
+    case Column::MYSQL_TYPE_INT24:
+    case Column::MYSQL_TYPE_LONG:
+    case Column::MYSQL_TYPE_LONGLONG:
+      return col->is_unsigned() ? DecodeUnsigned : DecodeSigned;
+    case Column::MYSQL_TYPE_BIT:
+      return DecodeUnsigned;
+    case Column::MYSQL_TYPE_YEAR:
+      return DecodeYear;
+    case Column::MYSQL_TYPE_FLOAT:
+      return DecodeFloat;
+    case Column::MYSQL_TYPE_DOUBLE:
+      return DecodeDouble;
+    case Column::MYSQL_TYPE_NEWDECIMAL:
+      return DecodeNewDecimal;
+    case Column::MYSQL_TYPE_NEWDATE:
+      return DecodeDate;
+    case Column::MYSQL_TYPE_TIME2:
+      return DecodeTime2;
+    case Column::MYSQL_TYPE_DATETIME2:
+      return DecodeDatetime2;
+    case Column::MYSQL_TYPE_TIMESTAMP2:
+      return DecodeTimestamp2;
+    case Column::MYSQL_TYPE_TIME:
+      return DecodeOldTime;
+    case Column::MYSQL_TYPE_DATETIME:
+      return DecodeOldDatetime;
+    case Column::MYSQL_TYPE_TIMESTAMP:
+      return DecodeOldTimestamp;
+    case Column::MYSQL_TYPE_ENUM:
+      return DecodeEnum;
+    case Column::MYSQL_TYPE_SET:
+      return DecodeSet;
+    case Column::MYSQL_TYPE_STRING:
+      return col->IsBinary() ? DecodeBinary : DecodeChar;
+    case Column::MYSQL_TYPE_DECIMAL:
+      // Digits stored as a string
+      return DecodeText;
+    case Column::MYSQL_TYPE_VAR_STRING:
+    case Column::MYSQL_TYPE_VARCHAR:
+    case Column::MYSQL_TYPE_TINY_BLOB:
+    case Column::MYSQL_TYPE_MEDIUM_BLOB:
+    case Column::MYSQL_TYPE_LONG_BLOB:
+    case Column::MYSQL_TYPE_BLOB:
+      return col->IsBinary() ? DecodeBinary : DecodeText;
+    case Column::MYSQL_TYPE_GEOMETRY:
+      return DecodeBinary;
+    case Column::MYSQL_TYPE_JSON:
+      return DecodeJson;
+    case Column::MYSQL_TYPE_VECTOR:
+      return DecodeVector;
+    default:
+      return DecodeNone;
+  }
+}
+
+FieldValue::Kind DecodedKind(const Column* col) {
+  FieldDecoder decoder = SelectFieldDecoder(col);
+  if (decoder == DecodeSigned) {
+    return FieldValue::INT;
+  }
+  if (decoder == DecodeUnsigned || decoder == DecodeYear) {
+    return FieldValue::UINT;
+  }
+  if (decoder == DecodeFloat) {
+    return FieldValue::FLOAT;
+  }
+  if (decoder == DecodeDouble) {
+    return FieldValue::DOUBLE;
+  }
+  if (decoder == DecodeBinary) {
+    return FieldValue::BINARY;
+  }
+  if (decoder == DecodeJson) {
+    return FieldValue::JSON;
+  }
+  if (decoder == DecodeVector) {
+    return FieldValue::VECTOR;
+  }
+  if (decoder == DecodeNone) {
+    return FieldValue::NONE;
+  }
+  return FieldValue::STRING;
+}
+
+}  // namespace ibd_ninja
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef FIELDVALUE_H_
+#define FIELDVALUE_H_
+
+#include "ibdUtils.h"
+
+#include <cstdint>
+#include <string>
+
+namespace ibd_ninja {
+
+class Column;
+
+// The value of a field decoded from its stored bytes. Numbers are kept as
+// numbers, character and binary data point into the record, and the other
+// types (DECIMAL, temporal types, ENUM, SET) are formatted into buf. Only
+// the rare text that doesn't fit, a SET with many long elements, is moved
+// to long_text, so decoding a field almost never allocates.
+struct FieldValue {
+  enum Kind {
+    NONE,
+    INT,
+    UINT,
+    FLOAT,
+    DOUBLE,
+    // Text in str/len, either the stored characters or formatted into buf
+    // or long_text
+    STRING,
+    // Raw bytes in str/len, for binary strings and geometries
+    BINARY,
+    // MySQL binary JSON in str/len
+    JSON,
+    // Little-endian float32 elements in str/len
+    VECTOR
+  };
+  // Enough for the 65 digits of the largest DECIMAL and most SET values
+  static constexpr uint32_t kBufSize = 256;
+
+  Kind kind = NONE;
+  union {
+    int64_t i;
+    uint64_t u;
+    double d;
+  };
+  const char* str = nullptr;
+  uint32_t len = 0;
+  char buf[kBufSize];
+  std::string long_text;
+
+  uint32_t vector_dimensions() const {
+    return len / sizeof(float);
+  }
+  float vector_element(uint32_t n) const;
+};
+
+// Decodes the stored bytes of a column. Returns false if they are not a
+// valid value of the column type, e.g. a length that doesn't match.
+typedef bool (*FieldDecoder)(const Column* col, const unsigned char* data,
+                             uint32_t len, FieldValue* value);
+
+// Picks the decoder of a column from its real type, called once when the
+// column is created
+FieldDecoder SelectFieldDecoder(const Column* col);
+
+// Kind of the values the decoder of a column produces, NONE if the type
+// can't be decoded
+FieldValue::Kind DecodedKind(const Column* col);
+
+// Writes a number with the fewest digits that read back to the same value,
+// returns the length of the text
+uint32_t FormatFloat(float f, char* buf, uint32_t size);
+uint32_t FormatDouble(double d, char* buf, uint32_t size);
+// For INT, UINT, FLOAT and DOUBLE values
+uint32_t FormatNumber(const FieldValue& value, char* buf, uint32_t size);
+
+// Compares an INT, UINT, FLOAT or DOUBLE value with number rounded to the
+// precision of the value, so that 3.14 equals a FLOAT 3.14. Sets cmp to
+// less than, equal to or greater than 0 as the value is less than, equal
+// to or greater than number. Returns false if the value is not a number.
+bool CompareNumber(const FieldValue& value, long double number, int* cmp);
+
+// Rewrites a decimal literal such as 1.2e3 or -.50 with plain digits, here
+// "1200" and "-0.5". Returns false if text is not a decimal number.
+bool NormalizeDecimal(const std::string& text, std::string* digits);
+// Compares the text of a DECIMAL value with digits, written by
+// NormalizeDecimal, exactly digit by digit whatever the precision. Sets
+// cmp as CompareNumber does. Returns false if the value is not a number.
+bool CompareDecimal(const FieldValue& value, const std::string& digits,
+                    int* cmp);
+
+// Passes the text of a value to put(const char* str, uint32_t len), in
+// several pieces for the values that are not held as a whole. Binary data
+// is written in hex and JSON as its text form.
+template <typename Put>
+void WriteFieldValueText(const FieldValue& value, Put&& put) {
+  static const char kHex[] = "0123456789abcdef";
+  char num[32];
+  switch (value.kind) {
+    case FieldValue::INT:
+    case FieldValue::UINT:
+    case FieldValue::FLOAT:
+    case FieldValue::DOUBLE:
+      put(num, FormatNumber(value, num, sizeof(num)));
+      break;
+    case FieldValue::STRING:
+      put(value.str, value.len);
+      break;
+    case FieldValue::BINARY:
+      for (uint32_t n = 0; n < value.len; n++) {
+        unsigned char c = static_cast<unsigned char>(value.str[n]);
+        num[0] = kHex[c >> 4];
+        num[1] = kHex[c & 0xF];
+        put(num, 2);
+      }
+      break;
+    case FieldValue::JSON: {
+      std::string json = JsonBinaryToString(
+          reinterpret_cast<const unsigned char*>(value.str), value.len);
+      put(json.data(), json.size());
+      break;
+    }
+    case FieldValue::VECTOR:
+      put("[", 1);
+      for (uint32_t n = 0; n < value.vector_dimensions(); n++) {
+        if (n > 0) {
+          put(",", 1);
+        }
+        put(num, FormatFloat(value.vector_element(n), num, sizeof(num)));
+      }
+      put("]", 1);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace ibd_ninja
+
+#endif  // FIELDVALUE_H_
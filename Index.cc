@@ -244,6 +244,31 @@ uint16_t Index::GetNUniqueInTreeNonleaf() {
   }
 }
 
+uint32_t Index::EstimateRecHeaderLen(bool leaf) {
+  uint32_t len = REC_N_NEW_EXTRA_BYTES;
+  if (leaf) {
+    uint32_t n_nullable = 0;
+    for (const FieldLayout& layout : field_layouts_) {
+      if (layout.null_pos != FieldLayout::kNotNullable) {
+        n_nullable++;
+      }
+      if (layout.fixed_len == 0) {
+        len += layout.big_col ? 2 : 1;
+      }
+    }
+    return len + UT_BITS_IN_BYTES(n_nullable);
+  }
+  len += UT_BITS_IN_BYTES(GetNullableBeforeInstantAddDrop());
+  uint32_t n_fields = GetNUniqueInTreeNonleaf();
+  for (uint32_t i = 0; i < n_fields && i < ib_fields_.size(); i++) {
+    IndexColumn* index_col = ib_fields_[i];
+    if (!index_col->ib_fixed_len()) {
+      len += index_col->column()->IsBigCol() ? 2 : 1;
+    }
+  }
+  return len;
+}
+
 IndexColumn* Index::GetPhysicalField(size_t pos) {
   if (ib_row_versions_) {
     return ib_fields_[ib_fields_array_[pos]];
@@ -252,6 +277,72 @@ IndexColumn* Index::GetPhysicalField(size_t pos) {
   return ib_fields_[pos];
 }
 
+bool Index::IsFieldDescending(size_t pos) {
+  Column* col = GetPhysicalField(pos)->column();
+  for (auto* iter : dd_elements_) {
+    if (!iter->hidden() && iter->column() == col) {
+      return iter->IsDescending();
+    }
+  }
+  // The primary key columns appended to a secondary index keep their order
+  // in the clustered index
+  if (!IsClustered() && table_->clust_index() != nullptr) {
+    Index* clust_index = table_->clust_index();
+    for (uint32_t i = 0; i < clust_index->ib_n_uniq(); i++) {
+      if (clust_index->GetPhysicalField(i)->column() == col) {
+        return clust_index->IsFieldDescending(i);
+      }
+    }
+  }
+  return false;
+}
+
+void Index::BuildFieldLayouts() {
+  field_layouts_.clear();
+  row_version_field_layouts_.clear();
+  if (!IsIndexSupported()) {
+    return;
+  }
+  uint32_t n_fields = GetNFields();
+  uint16_t n_nullable = 0;
+  for (uint32_t i = 0; i < n_fields; i++) {
+    IndexColumn* index_col = GetPhysicalField(i);
+    Column* col = index_col->column();
+    FieldLayout layout;
+    layout.missing = 0;
+    layout.instant = col->ib_instant_default() ? REC_OFFS_DEFAULT :
+                                                 REC_OFFS_SQL_NULL;
+    layout.fixed_len = static_cast<uint16_t>(index_col->ib_fixed_len());
+    layout.null_pos = col->is_nullable() ? n_nullable++ :
+                                           FieldLayout::kNotNullable;
+    layout.big_col = col->IsBigCol();
+    field_layouts_.push_back(layout);
+  }
+
+  if (!HasInstantColsOrRowVersions()) {
+    return;
+  }
+  uint32_t current_row_version = table_->ib_current_row_version();
+  for (uint32_t version = 0; version <= current_row_version; version++) {
+    n_nullable = 0;
+    for (uint32_t i = 0; i < n_fields; i++) {
+      Column* col = GetPhysicalField(i)->column();
+      FieldLayout layout = field_layouts_[i];
+      if (col->IsDroppedInOrBefore(version)) {
+        layout.missing = REC_OFFS_DROP;
+      } else if (col->IsAddedAfter(version)) {
+        layout.missing = layout.instant;
+      }
+      if (layout.missing != 0 || !col->is_nullable()) {
+        layout.null_pos = FieldLayout::kNotNullable;
+      } else {
+        layout.null_pos = n_nullable++;
+      }
+      row_version_field_layouts_.push_back(layout);
+    }
+  }
+}
+
 uint32_t Index::GetNFields() const {
   if (table_->HasRowVersions()) {
     return ib_n_total_fields_;
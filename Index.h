@@ -8,6 +8,8 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -19,7 +21,25 @@ constexpr uint32_t DICT_CLUSTERED = 1;
 constexpr uint32_t DICT_UNIQUE = 2;
 constexpr uint32_t DICT_FTS = 32;
 constexpr uint32_t DICT_SPATIAL = 64;
-const uint8_t MAX_ROW_VERSION = 64;
+
+// How a field is laid out in the leaf records of an index, for one row
+// version. Parsing a record walks an array of these instead of looking up
+// the index columns and columns of every field.
+struct FieldLayout {
+  static constexpr uint16_t kNotNullable = UINT16_MAX;
+  // REC_OFFS_DROP, REC_OFFS_DEFAULT or REC_OFFS_SQL_NULL if the field is
+  // not stored in the records of the row version, otherwise 0
+  uint32_t missing;
+  // REC_OFFS_DEFAULT or REC_OFFS_SQL_NULL, for the records of the old
+  // INSTANT ADD implementation that were inserted without the field
+  uint32_t instant;
+  // 0 for variable-length fields
+  uint16_t fixed_len;
+  // Bit of the field in the null bitmap, kNotNullable if there is none
+  uint16_t null_pos;
+  // Variable-length fields with a 2-byte length, see Column::IsBigCol
+  bool big_col;
+};
 
 class Table;
 class Index {
@@ -105,6 +125,9 @@ class Index {
   enum_index_type type() const {
     return dd_type_;
   }
+  bool hidden() const {
+    return dd_hidden_;
+  }
   const Properties& se_private_data() const {
     return dd_se_private_data_;
   }
@@ -188,6 +211,34 @@ class Index {
   uint16_t GetNUniqueInTree();
   uint16_t GetNUniqueInTreeNonleaf();
   IndexColumn* GetPhysicalField(size_t pos);
+  // Whether the field at pos of the records is sorted in descending order
+  bool IsFieldDescending(size_t pos);
+
+  // Precomputes the field layouts, called once all the indexes of the
+  // table are filled
+  void BuildFieldLayouts();
+  // GetNFields() layouts, in physical order, of the records that have no
+  // row version. Every field is stored, the records of the old INSTANT ADD
+  // implementation stop at their own number of fields.
+  const FieldLayout* GetFieldLayouts() const {
+    return field_layouts_.data();
+  }
+  // Layouts of the records of a row version, the versions after the
+  // current one of the table have the layouts of the current one
+  const FieldLayout* GetFieldLayouts(uint8_t row_version) const {
+    size_t n_fields = field_layouts_.size();
+    size_t n_versions = row_version_field_layouts_.size() / n_fields;
+    assert(n_versions > 0);
+    return row_version_field_layouts_.data() +
+           std::min<size_t>(row_version, n_versions - 1) * n_fields;
+  }
+
+  // Estimated header length of the records of a leaf or non-leaf page:
+  // the fixed extra bytes, the null bitmap and one length byte for each
+  // variable-length field, two for the ones that may need them. Records
+  // with an instant or row version marker are one or two bytes longer,
+  // and short values of big fields one byte shorter.
+  uint32_t EstimateRecHeaderLen(bool leaf);
 
   bool IsIndexSupported();
   std::string UnsupportedReason();
@@ -244,6 +295,10 @@ class Index {
   bool ib_instant_cols_;
   uint32_t ib_n_instant_nullable_;
   uint32_t ib_n_total_fields_;
+  std::vector<FieldLayout> field_layouts_;
+  // (current row version + 1) * GetNFields(), only for the clustered index
+  // of a table with instant columns or row versions
+  std::vector<FieldLayout> row_version_field_layouts_;
   Table* table_;
 };
 
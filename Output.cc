@@ -0,0 +1,1253 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "Output.h"
+#include "Table.h"
+#include "Index.h"
+#include "Column.h"
+
+#include <rapidjson/internal/itoa.h>
+#include <rapidjson/writer.h>
+
+#include <cstring>
+#include <string>
+
+namespace ibd_ninja {
+
+// Members of PageAnalysisResult, in the order they are written
+#define PAGE_ANALYSIS_RESULT_MEMBERS(M)                                     \
+  M(n_recs_non_leaf) M(n_recs_leaf)                                         \
+  M(headers_len_non_leaf) M(headers_len_leaf)                               \
+  M(recs_len_non_leaf) M(recs_len_leaf)                                     \
+  M(n_deleted_recs_non_leaf) M(n_deleted_recs_leaf)                         \
+  M(deleted_recs_len_non_leaf) M(deleted_recs_len_leaf)                     \
+  M(n_contain_dropped_cols_recs_non_leaf)                                   \
+  M(n_contain_dropped_cols_recs_leaf)                                       \
+  M(dropped_cols_len_non_leaf) M(dropped_cols_len_leaf)                     \
+  M(innodb_internal_used_non_leaf) M(innodb_internal_used_leaf)             \
+  M(free_non_leaf) M(free_leaf)                                             \
+  M(n_lob_fields) M(n_lob_pages) M(lob_data_len)
+
+static const char kHexDigits[] = "0123456789abcdef";
+
+static std::string TableName(Table* table) {
+  return table->schema_ref() + "." + table->name();
+}
+
+// Text values are always quoted, they may contain anything
+static void PutCsvValue(rapidjson::FileWriteStream* stream,
+                        const FieldValue& value) {
+  bool quoted = value.kind == FieldValue::STRING ||
+                value.kind == FieldValue::JSON ||
+                value.kind == FieldValue::VECTOR;
+  if (quoted) {
+    stream->Put('"');
+  }
+  WriteFieldValueText(value, [stream](const char* str, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+      if (str[i] == '"') {
+        stream->Put('"');
+      }
+      stream->Put(str[i]);
+    }
+  });
+  if (quoted) {
+    stream->Put('"');
+  }
+}
+
+OutputWriter::OutputWriter(FILE* file)
+  : stream_(file, buffer_, kBufferSize) {
+}
+
+OutputWriter::~OutputWriter() {
+  stream_.Flush();
+}
+
+const char* OutputWriter::FieldState(uint32_t offs) {
+  if (offs & REC_OFFS_SQL_NULL) {
+    return "null";
+  }
+  if (offs & REC_OFFS_DROP) {
+    return "dropped";
+  }
+  if (offs & REC_OFFS_DEFAULT) {
+    return "default";
+  }
+  if (offs & REC_OFFS_EXTERNAL) {
+    return "external";
+  }
+  return "value";
+}
+
+bool OutputWriter::DecodeField(IndexColumn* index_col,
+                               const unsigned char* data, uint32_t len,
+                               uint32_t offs, FieldValue* value) {
+  if (index_col == nullptr ||
+      (offs & (REC_OFFS_SQL_NULL | REC_OFFS_DROP | REC_OFFS_DEFAULT |
+               REC_OFFS_EXTERNAL))) {
+    return false;
+  }
+  return index_col->column()->Decode(data, len, value);
+}
+
+class JsonOutputWriter : public OutputWriter {
+ public:
+  explicit JsonOutputWriter(FILE* file)
+    : OutputWriter(file), writer_(stream_), in_records_(false) {
+  }
+  ~JsonOutputWriter() override {
+    stream_.Put('\n');
+  }
+
+  void BeginPage(uint32_t page_no, uint32_t page_type, uint32_t level,
+                 uint32_t n_recs, uint64_t index_id, Index* index) override {
+    writer_.StartObject();
+    writer_.Key("page_no");
+    writer_.Uint(page_no);
+    writer_.Key("page_type");
+    writer_.String(PageType2String(page_type).c_str());
+    if (page_type != FIL_PAGE_INDEX) {
+      return;
+    }
+    writer_.Key("level");
+    writer_.Uint(level);
+    writer_.Key("n_recs");
+    writer_.Uint(n_recs);
+    writer_.Key("index_id");
+    writer_.Uint64(index_id);
+    if (index != nullptr) {
+      writer_.Key("table");
+      writer_.String(TableName(index->table()).c_str());
+      writer_.Key("index");
+      writer_.String(index->name().c_str());
+    }
+  }
+  void BeginRecord(uint32_t row_no, bool deleted, uint32_t header_len,
+                   uint32_t rec_len) override {
+    if (!in_records_) {
+      writer_.Key("records");
+      writer_.StartArray();
+      in_records_ = true;
+    }
+    writer_.StartObject();
+    writer_.Key("row_no");
+    writer_.Uint(row_no);
+    writer_.Key("deleted");
+    writer_.Bool(deleted);
+    writer_.Key("header_len");
+    writer_.Uint(header_len);
+    writer_.Key("rec_len");
+    writer_.Uint(rec_len);
+    writer_.Key("fields");
+    writer_.StartArray();
+  }
+  void WriteField(uint32_t field_no, IndexColumn* index_col,
+                  const unsigned char* data, uint32_t len,
+                  uint32_t offs) override {
+    writer_.StartObject();
+    writer_.Key("field_no");
+    writer_.Uint(field_no);
+    writer_.Key("name");
+    if (index_col != nullptr) {
+      writer_.String(index_col->column()->name().c_str());
+      writer_.Key("type");
+      writer_.String(index_col->column()->dd_column_type_utf8().c_str());
+    } else {
+      writer_.String("*NODE_PTR");
+    }
+    writer_.Key("length");
+    writer_.Uint(len);
+    writer_.Key("state");
+    writer_.String(FieldState(offs));
+    writer_.Key("value");
+    if (offs & (REC_OFFS_SQL_NULL | REC_OFFS_DROP | REC_OFFS_DEFAULT)) {
+      writer_.Null();
+    } else {
+      hex_.resize(2 * static_cast<size_t>(len));
+      for (uint32_t i = 0; i < len; i++) {
+        hex_[2 * i] = kHexDigits[data[i] >> 4];
+        hex_[2 * i + 1] = kHexDigits[data[i] & 0xF];
+      }
+      writer_.String(hex_.data(), hex_.size());
+    }
+    writer_.Key("decoded");
+    FieldValue value;
+    if (DecodeField(index_col, data, len, offs, &value)) {
+      WriteValue(value);
+    } else {
+      writer_.Null();
+    }
+    if ((offs & REC_OFFS_EXTERNAL) && len >= BTR_EXTERN_FIELD_REF_SIZE) {
+      const unsigned char* ext_ref = data + len - BTR_EXTERN_FIELD_REF_SIZE;
+      writer_.Key("external");
+      writer_.StartObject();
+      writer_.Key("space_id");
+      writer_.Uint(ReadFrom4B(ext_ref + BTR_EXTERN_SPACE_ID));
+      writer_.Key("page_no");
+      writer_.Uint(ReadFrom4B(ext_ref + BTR_EXTERN_PAGE_NO));
+      writer_.Key("version");
+      writer_.Uint(ReadFrom4B(ext_ref + BTR_EXTERN_VERSION));
+      writer_.Key("length");
+      writer_.Uint64(ReadFrom8B(ext_ref + BTR_EXTERN_LEN) & 0x1FFFFFFFFFULL);
+      writer_.EndObject();
+    }
+    writer_.EndObject();
+  }
+  void EndRecord() override {
+    writer_.EndArray();
+    writer_.EndObject();
+  }
+  void EndPage(const PageAnalysisResult* result) override {
+    if (in_records_) {
+      writer_.EndArray();
+      in_records_ = false;
+    }
+    if (result != nullptr) {
+      WriteResult(*result);
+    }
+    writer_.EndObject();
+  }
+
+  void BeginTable(Table* table) override {
+    writer_.StartObject();
+    writer_.Key("table");
+    writer_.String(TableName(table).c_str());
+    writer_.Key("table_id");
+    writer_.Uint(table->ib_id());
+    writer_.Key("n_indexes");
+    writer_.Uint(table->indexes().size());
+    writer_.Key("indexes");
+    writer_.StartArray();
+  }
+  void WriteIndex(Index* index, const IndexAnalyzeResult& result,
+                  uint32_t page_size) override {
+    writer_.StartObject();
+    writer_.Key("index");
+    writer_.String(index->name().c_str());
+    writer_.Key("index_id");
+    writer_.Uint(index->ib_id());
+    writer_.Key("table");
+    writer_.String(TableName(index->table()).c_str());
+    writer_.Key("root_page_no");
+    writer_.Uint(index->ib_page());
+    writer_.Key("n_fields");
+    writer_.Uint(index->GetNFields());
+    writer_.Key("page_size");
+    writer_.Uint(page_size);
+    writer_.Key("n_levels");
+    writer_.Uint(result.n_level);
+    writer_.Key("n_pages_non_leaf");
+    writer_.Uint64(result.n_pages_non_leaf);
+    writer_.Key("n_pages_leaf");
+    writer_.Uint64(result.n_pages_leaf);
+    writer_.Key("n_pages_read");
+    writer_.Uint64(result.n_pages_read);
+    if (result.n_sampled_pages > 0) {
+      // Half widths of the 95% confidence intervals of the estimates
+      writer_.Key("n_sampled_pages");
+      writer_.Uint(result.n_sampled_pages);
+      writer_.Key("errors");
+      writer_.StartObject();
+      writer_.Key("n_pages");
+      writer_.Double(result.n_pages_error);
+      writer_.Key("n_pages_leaf");
+      writer_.Double(result.n_pages_leaf_error);
+      writer_.Key("n_recs_leaf");
+      writer_.Double(result.n_recs_leaf_error);
+      writer_.Key("valid_recs_len_leaf");
+      writer_.Double(result.valid_recs_len_leaf_error);
+      writer_.Key("deleted_recs_len_leaf");
+      writer_.Double(result.deleted_recs_len_leaf_error);
+      writer_.Key("free_leaf");
+      writer_.Double(result.free_leaf_error);
+      writer_.EndObject();
+    }
+    if (result.HasLeafChain()) {
+      writer_.Key("leaf_chain");
+      writer_.StartObject();
+      writer_.Key("n_discontinuities");
+      writer_.Uint64(result.n_leaf_discontinuities);
+      writer_.Key("avg_run");
+      writer_.Double(result.LeafAverageRun());
+      writer_.Key("n_extent_switches");
+      writer_.Uint64(result.n_leaf_extent_switches);
+      writer_.Key("n_seeks");
+      writer_.Uint64(result.n_leaf_seeks);
+      writer_.EndObject();
+    }
+    WriteResult(result.recs_result);
+    writer_.Key("levels");
+    writer_.StartArray();
+    for (size_t i = 0; i < result.levels.size(); i++) {
+      writer_.StartObject();
+      writer_.Key("level");
+      writer_.Uint64(i);
+      writer_.Key("n_pages");
+      writer_.Uint64(result.levels[i].n_pages);
+      WriteResult(result.levels[i].recs_result);
+      writer_.EndObject();
+    }
+    writer_.EndArray();
+    if (index->HasInstantColsOrRowVersions()) {
+      writer_.Key("current_row_version");
+      writer_.Uint(index->table()->ib_current_row_version());
+      writer_.Key("row_versions");
+      writer_.StartArray();
+      for (uint32_t i = 0; i <= MAX_ROW_VERSION; i++) {
+        const RecordGroupStats& stats = result.recs_result.row_versions[i];
+        if (stats.n_recs > 0) {
+          writer_.StartObject();
+          writer_.Key("row_version");
+          writer_.Uint(i);
+          WriteGroupStats(stats);
+          writer_.EndObject();
+        }
+      }
+      writer_.EndArray();
+      writer_.Key("insert_states");
+      writer_.StartArray();
+      for (uint32_t i = 0; i < REC_N_INSERT_STATES; i++) {
+        const RecordGroupStats& stats = result.recs_result.insert_states[i];
+        if (stats.n_recs > 0) {
+          writer_.StartObject();
+          writer_.Key("insert_state");
+          writer_.String(
+              InsertStateString(static_cast<REC_INSERT_STATE>(i)));
+          WriteGroupStats(stats);
+          writer_.EndObject();
+        }
+      }
+      writer_.EndArray();
+    }
+    if (g_size_stats) {
+      const PageAnalysisResult& recs = result.recs_result;
+      writer_.Key("size_stats");
+      writer_.StartObject();
+      writer_.Key("rec_len");
+      WriteLengths(recs.rec_lens_leaf);
+      writer_.Key("header_len");
+      WriteLengths(recs.headers_lens_leaf);
+      writer_.Key("fields");
+      writer_.StartArray();
+      for (size_t i = 0; i < recs.field_lens_leaf.size() &&
+                         i < index->GetNFields(); i++) {
+        writer_.StartObject();
+        writer_.Key("name");
+        writer_.String(
+            index->GetPhysicalField(i)->column()->name().c_str());
+        writer_.Key("len");
+        WriteLengths(recs.field_lens_leaf[i]);
+        writer_.EndObject();
+      }
+      writer_.EndArray();
+      writer_.EndObject();
+    }
+    writer_.EndObject();
+  }
+  void EndTable() override {
+    writer_.EndArray();
+    writer_.EndObject();
+  }
+
+ private:
+  // hex_ holds the hex of the field when this is called
+  void WriteValue(const FieldValue& value) {
+    char num[32];
+    switch (value.kind) {
+      case FieldValue::INT:
+        writer_.Int64(value.i);
+        break;
+      case FieldValue::UINT:
+        writer_.Uint64(value.u);
+        break;
+      case FieldValue::FLOAT:
+      case FieldValue::DOUBLE:
+        writer_.RawValue(num, FormatNumber(value, num, sizeof(num)),
+                         rapidjson::kNumberType);
+        break;
+      case FieldValue::STRING:
+        writer_.String(value.str, value.len);
+        break;
+      case FieldValue::JSON: {
+        std::string json = JsonBinaryToString(
+            reinterpret_cast<const unsigned char*>(value.str), value.len);
+        writer_.String(json.data(), json.size());
+        break;
+      }
+      case FieldValue::VECTOR:
+        writer_.StartArray();
+        for (uint32_t i = 0; i < value.vector_dimensions(); i++) {
+          writer_.RawValue(num, FormatFloat(value.vector_element(i), num,
+                                            sizeof(num)),
+                           rapidjson::kNumberType);
+        }
+        writer_.EndArray();
+        break;
+      default:
+        writer_.String(hex_.data(), hex_.size());
+        break;
+    }
+  }
+  void WriteResult(const PageAnalysisResult& result) {
+    writer_.Key("result");
+    writer_.StartObject();
+#define WRITE_MEMBER(member)   \
+    writer_.Key(#member);      \
+    writer_.Uint64(result.member);
+    PAGE_ANALYSIS_RESULT_MEMBERS(WRITE_MEMBER)
+#undef WRITE_MEMBER
+    writer_.EndObject();
+  }
+  // The non-empty buckets as [low, high, count], high of the last bucket
+  // is open
+  void WriteLengths(const LengthHistogram& lens) {
+    writer_.StartObject();
+    writer_.Key("n_values");
+    writer_.Uint64(lens.n_values);
+    writer_.Key("sum");
+    writer_.Uint64(lens.sum);
+    writer_.Key("p50");
+    writer_.Uint(lens.Percentile(0.5));
+    writer_.Key("p90");
+    writer_.Uint(lens.Percentile(0.9));
+    writer_.Key("p99");
+    writer_.Uint(lens.Percentile(0.99));
+    writer_.Key("max");
+    writer_.Uint(lens.max);
+    writer_.Key("buckets");
+    writer_.StartArray();
+    for (uint32_t i = 0; i < LengthHistogram::N_BUCKETS; i++) {
+      if (lens.buckets[i] == 0) {
+        continue;
+      }
+      writer_.StartArray();
+      writer_.Uint(LengthHistogram::BucketLow(i));
+      writer_.Uint(LengthHistogram::BucketHigh(i));
+      writer_.Uint64(lens.buckets[i]);
+      writer_.EndArray();
+    }
+    writer_.EndArray();
+    writer_.EndObject();
+  }
+  void WriteGroupStats(const RecordGroupStats& stats) {
+    writer_.Key("n_recs");
+    writer_.Uint64(stats.n_recs);
+    writer_.Key("recs_len");
+    writer_.Uint64(stats.recs_len);
+    writer_.Key("dropped_cols_len");
+    writer_.Uint64(stats.dropped_cols_len);
+  }
+
+  rapidjson::Writer<rapidjson::FileWriteStream> writer_;
+  bool in_records_;
+  // Reused for the hex value of every field
+  std::string hex_;
+};
+
+// Every kind of object is written as rows of its own table, the header is
+// printed before the first row. Pages are written one row per record field
+// when the records are output, otherwise one summary row per page.
+class CsvOutputWriter : public OutputWriter {
+ public:
+  explicit CsvOutputWriter(FILE* file)
+    : OutputWriter(file), page_no_(0), page_type_(0), level_(0),
+      n_recs_(0), index_id_(0), index_(nullptr), row_no_(0),
+      deleted_(false), header_len_(0), rec_len_(0),
+      page_has_records_(false), page_header_written_(false),
+      field_header_written_(false), index_header_written_(false) {
+  }
+
+  void BeginPage(uint32_t page_no, uint32_t page_type, uint32_t level,
+                 uint32_t n_recs, uint64_t index_id, Index* index) override {
+    page_no_ = page_no;
+    page_type_ = page_type;
+    level_ = level;
+    n_recs_ = n_recs;
+    index_id_ = index_id;
+    index_ = index;
+    page_has_records_ = false;
+  }
+  void BeginRecord(uint32_t row_no, bool deleted, uint32_t header_len,
+                   uint32_t rec_len) override {
+    page_has_records_ = true;
+    row_no_ = row_no;
+    deleted_ = deleted;
+    header_len_ = header_len;
+    rec_len_ = rec_len;
+  }
+  void WriteField(uint32_t field_no, IndexColumn* index_col,
+                  const unsigned char* data, uint32_t len,
+                  uint32_t offs) override {
+    if (!field_header_written_) {
+      PutRaw("page_no,row_no,deleted,header_len,rec_len,field_no,name,"
+             "type,length,state,value,decoded\n");
+      field_header_written_ = true;
+    }
+    PutUint(page_no_);
+    stream_.Put(',');
+    PutUint(row_no_);
+    stream_.Put(',');
+    PutUint(deleted_ ? 1 : 0);
+    stream_.Put(',');
+    PutUint(header_len_);
+    stream_.Put(',');
+    PutUint(rec_len_);
+    stream_.Put(',');
+    PutUint(field_no);
+    stream_.Put(',');
+    if (index_col != nullptr) {
+      PutString(index_col->column()->name());
+      stream_.Put(',');
+      PutString(index_col->column()->dd_column_type_utf8());
+    } else {
+      PutRaw("*NODE_PTR,");
+    }
+    stream_.Put(',');
+    PutUint(len);
+    stream_.Put(',');
+    PutRaw(FieldState(offs));
+    stream_.Put(',');
+    if (!(offs & (REC_OFFS_SQL_NULL | REC_OFFS_DROP | REC_OFFS_DEFAULT))) {
+      for (uint32_t i = 0; i < len; i++) {
+        stream_.Put(kHexDigits[data[i] >> 4]);
+        stream_.Put(kHexDigits[data[i] & 0xF]);
+      }
+    }
+    stream_.Put(',');
+    FieldValue value;
+    if (DecodeField(index_col, data, len, offs, &value)) {
+      PutValue(value);
+    }
+    stream_.Put('\n');
+  }
+  void EndRecord() override {
+  }
+  void EndPage(const PageAnalysisResult* result) override {
+    if (page_has_records_) {
+      return;
+    }
+    if (!page_header_written_) {
+      PutRaw("page_no,page_type,level,n_recs,index_id,table,index");
+      PutResultHeader();
+      page_header_written_ = true;
+    }
+    PutUint(page_no_);
+    stream_.Put(',');
+    PutString(PageType2String(page_type_));
+    stream_.Put(',');
+    PutUint(level_);
+    stream_.Put(',');
+    PutUint(n_recs_);
+    stream_.Put(',');
+    PutUint(index_id_);
+    stream_.Put(',');
+    if (index_ != nullptr) {
+      PutString(TableName(index_->table()));
+      stream_.Put(',');
+      PutString(index_->name());
+    } else {
+      stream_.Put(',');
+    }
+    PutResult(result);
+  }
+
+  void BeginTable(Table* /* table */) override {
+  }
+  void WriteIndex(Index* index, const IndexAnalyzeResult& result,
+                  uint32_t page_size) override {
+    if (!index_header_written_) {
+      PutRaw("table_id,table,index_id,index,root_page_no,n_fields,"
+             "page_size,n_levels,n_pages_non_leaf,n_pages_leaf,"
+             "n_pages_read");
+      PutResultHeader();
+      index_header_written_ = true;
+    }
+    PutUint(index->table()->ib_id());
+    stream_.Put(',');
+    PutString(TableName(index->table()));
+    stream_.Put(',');
+    PutUint(index->ib_id());
+    stream_.Put(',');
+    PutString(index->name());
+    stream_.Put(',');
+    PutUint(index->ib_page());
+    stream_.Put(',');
+    PutUint(index->GetNFields());
+    stream_.Put(',');
+    PutUint(page_size);
+    stream_.Put(',');
+    PutUint(result.n_level);
+    stream_.Put(',');
+    PutUint(result.n_pages_non_leaf);
+    stream_.Put(',');
+    PutUint(result.n_pages_leaf);
+    stream_.Put(',');
+    PutUint(result.n_pages_read);
+    PutResult(&result.recs_result);
+  }
+  void EndTable() override {
+  }
+
+ private:
+  void PutRaw(const char* str) {
+    while (*str != '\0') {
+      stream_.Put(*str++);
+    }
+  }
+  void PutUint(uint64_t value) {
+    char buf[24];
+    char* end = rapidjson::internal::u64toa(value, buf);
+    for (char* p = buf; p < end; p++) {
+      stream_.Put(*p);
+    }
+  }
+  // Quoted only if needed, e.g. for "decimal(10,2)"
+  void PutString(const std::string& str) {
+    if (str.find_first_of(",\"\r\n") == std::string::npos) {
+      PutRaw(str.c_str());
+      return;
+    }
+    stream_.Put('"');
+    for (char c : str) {
+      if (c == '"') {
+        stream_.Put('"');
+      }
+      stream_.Put(c);
+    }
+    stream_.Put('"');
+  }
+  void PutValue(const FieldValue& value) {
+    PutCsvValue(&stream_, value);
+  }
+  void PutResultHeader() {
+#define PUT_MEMBER_NAME(member) \
+    PutRaw("," #member);
+    PAGE_ANALYSIS_RESULT_MEMBERS(PUT_MEMBER_NAME)
+#undef PUT_MEMBER_NAME
+    stream_.Put('\n');
+  }
+  // The columns are left empty if the records were not analyzed
+  void PutResult(const PageAnalysisResult* result) {
+#define PUT_MEMBER(member)         \
+    stream_.Put(',');              \
+    if (result != nullptr) {       \
+      PutUint(result->member);     \
+    }
+    PAGE_ANALYSIS_RESULT_MEMBERS(PUT_MEMBER)
+#undef PUT_MEMBER
+    stream_.Put('\n');
+  }
+
+  uint32_t page_no_;
+  uint32_t page_type_;
+  uint32_t level_;
+  uint32_t n_recs_;
+  uint64_t index_id_;
+  Index* index_;
+  uint32_t row_no_;
+  bool deleted_;
+  uint32_t header_len_;
+  uint32_t rec_len_;
+  bool page_has_records_;
+  bool page_header_written_;
+  bool field_header_written_;
+  bool index_header_written_;
+};
+
+OutputWriter* OutputWriter::Create(OutputFormat format, FILE* file) {
+  switch (format) {
+    case OutputFormat::JSON:
+      return new JsonOutputWriter(file);
+    case OutputFormat::CSV:
+      return new CsvOutputWriter(file);
+    default:
+      return nullptr;
+  }
+}
+
+RowWriter::RowWriter(FILE* file)
+  : file_(file), buffer_(new char[kBufferSize]),
+    stream_(file, buffer_, kBufferSize) {
+}
+
+RowWriter::~RowWriter() {
+  stream_.Flush();
+  delete [] buffer_;
+}
+
+// NULL is an empty field, while an empty string is written as ""
+class CsvRowWriter : public RowWriter {
+ public:
+  explicit CsvRowWriter(FILE* file) : RowWriter(file), first_(true) {
+  }
+
+  void BeginExport(Table* /* table */,
+                   const std::vector<Column*>& columns) override {
+    BeginRow();
+    for (auto col : columns) {
+      Separate();
+      FieldValue name;
+      name.kind = FieldValue::STRING;
+      name.str = col->name().data();
+      name.len = col->name().size();
+      PutCsvValue(&stream_, name);
+    }
+    EndRow();
+  }
+  void BeginRow() override {
+    first_ = true;
+  }
+  void WriteNull() override {
+    Separate();
+  }
+  void WriteValue(const FieldValue& value) override {
+    Separate();
+    PutCsvValue(&stream_, value);
+  }
+  void EndRow() override {
+    stream_.Put('\n');
+  }
+  void EndExport() override {
+  }
+
+ private:
+  void Separate() {
+    if (!first_) {
+      stream_.Put(',');
+    }
+    first_ = false;
+  }
+
+  bool first_;
+};
+
+// Escaped the way LOAD DATA reads it by default, NULL is written as \N
+class TsvRowWriter : public RowWriter {
+ public:
+  explicit TsvRowWriter(FILE* file) : RowWriter(file), first_(true) {
+  }
+
+  void BeginExport(Table* /* table */,
+                   const std::vector<Column*>& columns) override {
+    BeginRow();
+    for (auto col : columns) {
+      Separate();
+      PutEscaped(col->name().data(), col->name().size());
+    }
+    EndRow();
+  }
+  void BeginRow() override {
+    first_ = true;
+  }
+  void WriteNull() override {
+    Separate();
+    stream_.Put('\\');
+    stream_.Put('N');
+  }
+  void WriteValue(const FieldValue& value) override {
+    Separate();
+    WriteFieldValueText(value, [this](const char* str, uint32_t len) {
+      PutEscaped(str, len);
+    });
+  }
+  void EndRow() override {
+    stream_.Put('\n');
+  }
+  void EndExport() override {
+  }
+
+ private:
+  void Separate() {
+    if (!first_) {
+      stream_.Put('\t');
+    }
+    first_ = false;
+  }
+  void PutEscaped(const char* str, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+      switch (str[i]) {
+        case '\\':
+          stream_.Put('\\');
+          stream_.Put('\\');
+          break;
+        case '\t':
+          stream_.Put('\\');
+          stream_.Put('t');
+          break;
+        case '\n':
+          stream_.Put('\\');
+          stream_.Put('n');
+          break;
+        case '\r':
+          stream_.Put('\\');
+          stream_.Put('r');
+          break;
+        case '\0':
+          stream_.Put('\\');
+          stream_.Put('0');
+          break;
+        default:
+          stream_.Put(str[i]);
+          break;
+      }
+    }
+  }
+
+  bool first_;
+};
+
+// Numbers are written as JSON numbers and vectors as arrays, every other
+// value as a string, JSON documents included
+class JsonlRowWriter : public RowWriter {
+ public:
+  explicit JsonlRowWriter(FILE* file)
+    : RowWriter(file), writer_(stream_), n_(0) {
+  }
+
+  void BeginExport(Table* /* table */,
+                   const std::vector<Column*>& columns) override {
+    for (auto col : columns) {
+      names_.push_back(col->name());
+    }
+  }
+  void BeginRow() override {
+    writer_.StartObject();
+    n_ = 0;
+  }
+  void WriteNull() override {
+    writer_.Key(names_[n_].data(), names_[n_].size());
+    n_++;
+    writer_.Null();
+  }
+  void WriteValue(const FieldValue& value) override {
+    writer_.Key(names_[n_].data(), names_[n_].size());
+    n_++;
+    char num[32];
+    switch (value.kind) {
+      case FieldValue::INT:
+        writer_.Int64(value.i);
+        break;
+      case FieldValue::UINT:
+        writer_.Uint64(value.u);
+        break;
+      case FieldValue::FLOAT:
+      case FieldValue::DOUBLE:
+        writer_.RawValue(num, FormatNumber(value, num, sizeof(num)),
+                         rapidjson::kNumberType);
+        break;
+      case FieldValue::STRING:
+        writer_.String(value.str, value.len);
+        break;
+      case FieldValue::VECTOR:
+        writer_.StartArray();
+        for (uint32_t i = 0; i < value.vector_dimensions(); i++) {
+          writer_.RawValue(num, FormatFloat(value.vector_element(i), num,
+                                            sizeof(num)),
+                           rapidjson::kNumberType);
+        }
+        writer_.EndArray();
+        break;
+      default:
+        text_.clear();
+        WriteFieldValueText(value, [this](const char* str, uint32_t len) {
+          text_.append(str, len);
+        });
+        writer_.String(text_.data(), text_.size());
+        break;
+    }
+  }
+  void EndRow() override {
+    writer_.EndObject();
+    stream_.Put('\n');
+    writer_.Reset(stream_);
+  }
+  void EndExport() override {
+  }
+
+ private:
+  rapidjson::Writer<rapidjson::FileWriteStream> writer_;
+  std::vector<std::string> names_;
+  // Column of the next value
+  size_t n_;
+  // Reused for the text of binary and JSON values
+  std::string text_;
+};
+
+// Multi-row INSERT statements that the mysql client can replay. Strings
+// are escaped like mysqldump does, binary values are written as hex
+// literals as with mysqldump --hex-blob.
+class SqlRowWriter : public RowWriter {
+ public:
+  SqlRowWriter(FILE* file, uint32_t rows_per_insert)
+    : RowWriter(file), rows_per_insert_(rows_per_insert == 0 ? 1 :
+                                        rows_per_insert),
+      n_rows_(0), first_(true) {
+  }
+
+  void BeginExport(Table* table,
+                   const std::vector<Column*>& columns) override {
+    insert_ = "INSERT INTO ";
+    AppendIdentifier(table->name());
+    insert_ += " (";
+    for (size_t i = 0; i < columns.size(); i++) {
+      if (i > 0) {
+        insert_ += ",";
+      }
+      AppendIdentifier(columns[i]->name());
+    }
+    insert_ += ") VALUES ";
+    // TIMESTAMP values are decoded in UTC
+    const char* header = "/*!40103 SET TIME_ZONE='+00:00' */;\n";
+    PutRaw(header, strlen(header));
+  }
+  void BeginRow() override {
+    if (n_rows_ == 0) {
+      PutRaw(insert_.data(), insert_.size());
+    } else {
+      stream_.Put(',');
+    }
+    stream_.Put('(');
+    first_ = true;
+  }
+  void WriteNull() override {
+    Separate();
+    PutRaw("NULL", 4);
+  }
+  void WriteValue(const FieldValue& value) override {
+    Separate();
+    switch (value.kind) {
+      case FieldValue::INT:
+      case FieldValue::UINT:
+      case FieldValue::FLOAT:
+      case FieldValue::DOUBLE: {
+        char num[32];
+        PutRaw(num, FormatNumber(value, num, sizeof(num)));
+        break;
+      }
+      case FieldValue::BINARY:
+      case FieldValue::VECTOR:
+        if (value.len == 0) {
+          PutRaw("''", 2);
+          break;
+        }
+        PutRaw("0x", 2);
+        for (uint32_t i = 0; i < value.len; i++) {
+          unsigned char c = static_cast<unsigned char>(value.str[i]);
+          stream_.Put(kHexDigits[c >> 4]);
+          stream_.Put(kHexDigits[c & 0xF]);
+        }
+        break;
+      default:
+        stream_.Put('\'');
+        WriteFieldValueText(value, [this](const char* str, uint32_t len) {
+          PutEscaped(str, len);
+        });
+        stream_.Put('\'');
+        break;
+    }
+  }
+  void EndRow() override {
+    stream_.Put(')');
+    if (++n_rows_ == rows_per_insert_) {
+      PutRaw(";\n", 2);
+      n_rows_ = 0;
+    }
+  }
+  void EndExport() override {
+    if (n_rows_ > 0) {
+      PutRaw(";\n", 2);
+      n_rows_ = 0;
+    }
+  }
+
+ private:
+  void AppendIdentifier(const std::string& name) {
+    insert_ += '`';
+    for (char c : name) {
+      if (c == '`') {
+        insert_ += '`';
+      }
+      insert_ += c;
+    }
+    insert_ += '`';
+  }
+  void Separate() {
+    if (!first_) {
+      stream_.Put(',');
+    }
+    first_ = false;
+  }
+  void PutRaw(const char* str, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+      stream_.Put(str[i]);
+    }
+  }
+  void PutEscaped(const char* str, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+      char escape = 0;
+      switch (str[i]) {
+        case '\0':
+          escape = '0';
+          break;
+        case '\n':
+          escape = 'n';
+          break;
+        case '\r':
+          escape = 'r';
+          break;
+        case '\\':
+        case '\'':
+        case '"':
+          escape = str[i];
+          break;
+        case '\032':
+          escape = 'Z';
+          break;
+        default:
+          break;
+      }
+      if (escape != 0) {
+        stream_.Put('\\');
+        stream_.Put(escape);
+      } else {
+        stream_.Put(str[i]);
+      }
+    }
+  }
+
+  uint32_t rows_per_insert_;
+  // Rows written to the current INSERT statement
+  uint32_t n_rows_;
+  bool first_;
+  // "INSERT INTO `table` (`col`,...) VALUES "
+  std::string insert_;
+};
+
+// The values of a row group are collected per column and every column is
+// written as one block, see the format in Output.h
+class ColumnarRowWriter : public RowWriter {
+ public:
+  explicit ColumnarRowWriter(FILE* file)
+    : RowWriter(file), n_rows_(0), n_(0), buffered_(0) {
+  }
+
+  void BeginExport(Table* /* table */,
+                   const std::vector<Column*>& columns) override {
+    scratch_.assign("IBDNCOL\0", 8);
+    AppendLE(&scratch_, kVersion, 4);
+    AppendLE(&scratch_, columns.size(), 4);
+    for (auto col : columns) {
+      ColumnChunk chunk;
+      chunk.type = ColumnType(DecodedKind(col));
+      chunk.offsets.push_back(0);
+      chunks_.push_back(chunk);
+      const std::string& sql_type = col->dd_column_type_utf8();
+      AppendLE(&scratch_, chunk.type, 1);
+      AppendLE(&scratch_, col->name().size(), 2);
+      scratch_ += col->name();
+      AppendLE(&scratch_, sql_type.size(), 2);
+      scratch_ += sql_type;
+    }
+    Write(scratch_.data(), scratch_.size());
+  }
+  void BeginRow() override {
+    n_ = 0;
+  }
+  void WriteNull() override {
+    ColumnChunk& chunk = chunks_[n_++];
+    if (chunk.nulls.size() <= n_rows_ / 8) {
+      chunk.nulls.resize(n_rows_ / 8 + 1, 0);
+    }
+    chunk.nulls[n_rows_ / 8] |= static_cast<char>(1 << (n_rows_ % 8));
+    uint32_t width = FixedWidth(chunk.type);
+    if (width > 0) {
+      chunk.data.append(width, '\0');
+      buffered_ += width;
+    } else {
+      chunk.offsets.push_back(chunk.data.size());
+    }
+  }
+  void WriteValue(const FieldValue& value) override {
+    ColumnChunk& chunk = chunks_[n_];
+    if (value.kind != ChunkKind(chunk.type)) {
+      WriteNull();
+      return;
+    }
+    n_++;
+    size_t size = chunk.data.size();
+    switch (chunk.type) {
+      case kInt64:
+      case kUint64:
+        AppendLE(&chunk.data, value.u, 8);
+        break;
+      case kFloat32: {
+        float f = static_cast<float>(value.d);
+        uint32_t bits = 0;
+        memcpy(&bits, &f, sizeof(bits));
+        AppendLE(&chunk.data, bits, 4);
+        break;
+      }
+      case kFloat64: {
+        uint64_t bits = 0;
+        memcpy(&bits, &value.d, sizeof(bits));
+        AppendLE(&chunk.data, bits, 8);
+        break;
+      }
+      case kJson:
+        chunk.data += JsonBinaryToString(
+            reinterpret_cast<const unsigned char*>(value.str), value.len);
+        break;
+      default:
+        chunk.data.append(value.str, value.len);
+        break;
+    }
+    if (FixedWidth(chunk.type) == 0) {
+      chunk.offsets.push_back(chunk.data.size());
+    }
+    buffered_ += chunk.data.size() - size;
+  }
+  void EndRow() override {
+    if (++n_rows_ == kRowGroupRows || buffered_ >= kRowGroupBytes) {
+      FlushRowGroup();
+    }
+  }
+  void EndExport() override {
+    if (n_rows_ > 0) {
+      FlushRowGroup();
+    }
+    scratch_.clear();
+    AppendLE(&scratch_, 0, 4);
+    Write(scratch_.data(), scratch_.size());
+  }
+
+ private:
+  enum ChunkType : uint8_t {
+    kInt64 = 1,
+    kUint64 = 2,
+    kFloat32 = 3,
+    kFloat64 = 4,
+    kString = 5,
+    kBinary = 6,
+    kJson = 7,
+    kVector = 8
+  };
+  struct ColumnChunk {
+    ChunkType type = kString;
+    std::string nulls;
+    std::vector<uint64_t> offsets;
+    std::string data;
+  };
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kRowGroupRows = 65536;
+  // A row group is also ended early once its values take this much memory
+  static constexpr size_t kRowGroupBytes = 256 * 1024 * 1024;
+
+  static ChunkType ColumnType(FieldValue::Kind kind) {
+    switch (kind) {
+      case FieldValue::INT:
+        return kInt64;
+      case FieldValue::UINT:
+        return kUint64;
+      case FieldValue::FLOAT:
+        return kFloat32;
+      case FieldValue::DOUBLE:
+        return kFloat64;
+      case FieldValue::BINARY:
+        return kBinary;
+      case FieldValue::JSON:
+        return kJson;
+      case FieldValue::VECTOR:
+        return kVector;
+      default:
+        // Columns that can't be decoded are written as all NULL strings
+        return kString;
+    }
+  }
+  static FieldValue::Kind ChunkKind(ChunkType type) {
+    static const FieldValue::Kind kinds[] = {
+      FieldValue::NONE, FieldValue::INT, FieldValue::UINT, FieldValue::FLOAT,
+      FieldValue::DOUBLE, FieldValue::STRING, FieldValue::BINARY,
+      FieldValue::JSON, FieldValue::VECTOR
+    };
+    return kinds[type];
+  }
+  // 0 for the variable-length types
+  static uint32_t FixedWidth(ChunkType type) {
+    switch (type) {
+      case kInt64:
+      case kUint64:
+      case kFloat64:
+        return 8;
+      case kFloat32:
+        return 4;
+      default:
+        return 0;
+    }
+  }
+  static void AppendLE(std::string* buf, uint64_t value, uint32_t n_bytes) {
+    for (uint32_t i = 0; i < n_bytes; i++) {
+      buf->push_back(static_cast<char>(value >> (8 * i)));
+    }
+  }
+  // The row groups bypass stream_, it is flushed first to keep the order
+  void Write(const void* data, size_t size) {
+    stream_.Flush();
+    fwrite(data, 1, size, file_);
+  }
+  void FlushRowGroup() {
+    scratch_.clear();
+    AppendLE(&scratch_, n_rows_, 4);
+    Write(scratch_.data(), scratch_.size());
+    for (auto& chunk : chunks_) {
+      chunk.nulls.resize((n_rows_ + 7) / 8, 0);
+      size_t offsets_len = 0;
+      if (FixedWidth(chunk.type) == 0) {
+        offsets_len = 8 * chunk.offsets.size();
+      }
+      scratch_.clear();
+      AppendLE(&scratch_, chunk.nulls.size() + offsets_len +
+                          chunk.data.size(), 8);
+      scratch_ += chunk.nulls;
+      if (offsets_len > 0) {
+        for (auto offset : chunk.offsets) {
+          AppendLE(&scratch_, offset, 8);
+        }
+      }
+      Write(scratch_.data(), scratch_.size());
+      Write(chunk.data.data(), chunk.data.size());
+      chunk.nulls.clear();
+      chunk.offsets.assign(1, 0);
+      chunk.data.clear();
+    }
+    n_rows_ = 0;
+    buffered_ = 0;
+  }
+
+  std::vector<ColumnChunk> chunks_;
+  // Rows in the current row group
+  uint32_t n_rows_;
+  // Column of the next value
+  size_t n_;
+  // Bytes of values in the current row group
+  size_t buffered_;
+  // Reused for the header, the row counts and the offsets
+  std::string scratch_;
+};
+
+RowWriter* RowWriter::Create(const ExportOptions& options, FILE* file) {
+  switch (options.format) {
+    case ExportFormat::TSV:
+      return new TsvRowWriter(file);
+    case ExportFormat::JSONL:
+      return new JsonlRowWriter(file);
+    case ExportFormat::SQL:
+      return new SqlRowWriter(file, options.rows_per_insert);
+    case ExportFormat::COLUMNAR:
+      return new ColumnarRowWriter(file);
+    default:
+      return new CsvRowWriter(file);
+  }
+}
+
+}  // namespace ibd_ninja
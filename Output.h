@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include "ibdUtils.h"
+#include "Record.h"
+#include "FieldValue.h"
+
+#include <rapidjson/filewritestream.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace ibd_ninja {
+
+class Table;
+class Index;
+class IndexColumn;
+class Column;
+
+// Serializes the page, index and table analysis results for --format json
+// and csv. Everything goes through one buffered stream, so the output is
+// written in large blocks instead of one call per value.
+//
+// A page is written as BeginPage, then optionally BeginRecord, WriteField...
+// and EndRecord for each record, then EndPage. A table is written as
+// BeginTable, WriteIndex for each index and EndTable.
+class OutputWriter {
+ public:
+  // Returns nullptr for OutputFormat::TEXT
+  static OutputWriter* Create(OutputFormat format, FILE* file);
+  // Flushes the buffered output
+  virtual ~OutputWriter();
+
+  // index is nullptr if the page doesn't belong to a loaded index
+  virtual void BeginPage(uint32_t page_no, uint32_t page_type,
+                         uint32_t level, uint32_t n_recs,
+                         uint64_t index_id, Index* index) = 0;
+  virtual void BeginRecord(uint32_t row_no, bool deleted,
+                           uint32_t header_len, uint32_t rec_len) = 0;
+  // index_col is nullptr for the child page number of a node pointer, and
+  // offs is the field end offset along with its REC_OFFS_* flags
+  virtual void WriteField(uint32_t field_no, IndexColumn* index_col,
+                          const unsigned char* data, uint32_t len,
+                          uint32_t offs) = 0;
+  virtual void EndRecord() = 0;
+  // result is nullptr if the records of the page were not analyzed
+  virtual void EndPage(const PageAnalysisResult* result) = 0;
+
+  virtual void BeginTable(Table* table) = 0;
+  virtual void WriteIndex(Index* index, const IndexAnalyzeResult& result,
+                          uint32_t page_size) = 0;
+  virtual void EndTable() = 0;
+
+ protected:
+  explicit OutputWriter(FILE* file);
+
+  // Value of a field: "value", or why there is none
+  static const char* FieldState(uint32_t offs);
+  // Decodes a field that has its whole value in the record
+  static bool DecodeField(IndexColumn* index_col, const unsigned char* data,
+                          uint32_t len, uint32_t offs, FieldValue* value);
+
+  static constexpr size_t kBufferSize = 64 * 1024;
+  char buffer_[kBufferSize];
+  rapidjson::FileWriteStream stream_;
+};
+
+enum class ExportFormat { CSV, TSV, JSONL, SQL, COLUMNAR };
+
+struct ExportOptions {
+  ExportFormat format = ExportFormat::CSV;
+  // Rows in each INSERT statement of ExportFormat::SQL
+  uint32_t rows_per_insert = 1000;
+  // Only the rows matching this expression are exported, see Predicate
+  std::string where;
+};
+
+// Writes the rows of --export-table, one line per row. CSV and TSV start
+// with a header line of the column names, JSON Lines writes every row as
+// an object keyed by them, and SQL groups the rows into multi-row INSERT
+// statements. The rows are streamed through a large buffer, so that
+// writing keeps up with reading the leaf pages.
+//
+// COLUMNAR is a binary container that analytics tools can load without
+// parsing. All integers are little-endian:
+//
+//   file      := header row_group* uint32(0)
+//   header    := "IBDNCOL\0" uint32(version = 1) uint32(n_columns)
+//                column_info{n_columns}
+//   column_info := uint8(type) uint16(name_len) name
+//                  uint16(sql_type_len) sql_type
+//   row_group := uint32(n_rows > 0) column_chunk{n_columns}
+//   column_chunk := uint64(chunk_len) null_bitmap values
+//
+// The null bitmap has (n_rows + 7) / 8 bytes, bit (i % 8) of byte (i / 8)
+// is set if row i is NULL. The values of the fixed-width types are stored
+// back to back, zero for NULL rows: INT64 (1), UINT64 (2), FLOAT32 (3) and
+// FLOAT64 (4). The variable-length types, STRING (5), BINARY (6), JSON (7)
+// as text and VECTOR (8) as float32 elements, have n_rows + 1 uint64 offsets
+// into the data that follows them. A row group has at most 65536 rows.
+//
+// The export is written as BeginExport, then BeginRow, WriteNull or
+// WriteValue for each column and EndRow for each row, then EndExport.
+class RowWriter {
+ public:
+  static RowWriter* Create(const ExportOptions& options, FILE* file);
+  // Flushes the buffered output
+  virtual ~RowWriter();
+
+  virtual void BeginExport(Table* table,
+                           const std::vector<Column*>& columns) = 0;
+  virtual void BeginRow() = 0;
+  virtual void WriteNull() = 0;
+  virtual void WriteValue(const FieldValue& value) = 0;
+  virtual void EndRow() = 0;
+  virtual void EndExport() = 0;
+
+ protected:
+  explicit RowWriter(FILE* file);
+
+  static constexpr size_t kBufferSize = 1024 * 1024;
+  FILE* file_;
+  char* buffer_;
+  rapidjson::FileWriteStream stream_;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // OUTPUT_H_
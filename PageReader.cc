@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "PageReader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+
+namespace ibd_ninja {
+
+PageReader::PageReader(Tablespace* space,
+                       const std::vector<uint32_t>* pages_no,
+                       uint32_t queue_depth)
+  : space_(space), pages_no_(pages_no), next_issue_(0), next_consume_(0),
+    holding_(false), stop_(false) {
+  assert(pages_no_ != nullptr);
+  queue_depth_ = std::max<uint32_t>(1, std::min<size_t>(queue_depth,
+                                                        pages_no_->size()));
+  uint32_t page_size = space_->page_physical_size();
+  bufs_unalign_ = new unsigned char[(queue_depth_ + 1) * page_size];
+  unsigned char* bufs = static_cast<unsigned char*>(
+                    ut_align(bufs_unalign_, page_size));
+  slots_.resize(queue_depth_);
+  for (uint32_t i = 0; i < queue_depth_; i++) {
+    slots_[i].buf = bufs + i * page_size;
+  }
+  // Every I/O thread has at most one synchronous read in flight
+  for (uint32_t i = 0; i < queue_depth_; i++) {
+    io_threads_.emplace_back(&PageReader::IOThread, this);
+  }
+}
+
+PageReader::~PageReader() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  issue_cond_.notify_all();
+  for (auto& t : io_threads_) {
+    t.join();
+  }
+  delete [] bufs_unalign_;
+}
+
+void PageReader::IOThread() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    issue_cond_.wait(lock, [this] {
+      return stop_ || (next_issue_ < pages_no_->size() &&
+                       next_issue_ < next_consume_ + queue_depth_);
+    });
+    if (stop_) {
+      return;
+    }
+    size_t i = next_issue_++;
+    Slot& slot = slots_[i % queue_depth_];
+    slot.state = SLOT_READING;
+    lock.unlock();
+
+    ssize_t bytes = space_->ReadPage(pages_no_->at(i), slot.buf);
+    int read_errno = errno;
+
+    lock.lock();
+    slot.failed = (bytes != space_->page_physical_size());
+    slot.read_errno = read_errno;
+    slot.state = SLOT_READY;
+    ready_cond_.notify_all();
+  }
+}
+
+unsigned char* PageReader::Next() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (holding_) {
+    // Hand the slot of the previous page back to the I/O threads
+    slots_[next_consume_ % queue_depth_].state = SLOT_FREE;
+    next_consume_++;
+    holding_ = false;
+    issue_cond_.notify_all();
+  }
+  if (next_consume_ >= pages_no_->size()) {
+    errno = 0;
+    return nullptr;
+  }
+  Slot& slot = slots_[next_consume_ % queue_depth_];
+  ready_cond_.wait(lock, [&slot] { return slot.state == SLOT_READY; });
+  holding_ = true;
+  if (slot.failed) {
+    errno = slot.read_errno;
+    return nullptr;
+  }
+  return slot.buf;
+}
+
+size_t PageReader::n_pages_read() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return next_issue_;
+}
+
+}  // namespace ibd_ninja
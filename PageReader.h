@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef PAGEREADER_H_
+#define PAGEREADER_H_
+
+#include "ibdUtils.h"
+#include "Tablespace.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ibd_ninja {
+
+// Reads a known list of pages of a tablespace ahead of the consumer. A pool
+// of I/O threads keeps up to queue_depth reads in flight into a ring of page
+// buffers, and the consumer takes the pages back in list order with Next().
+class PageReader {
+ public:
+  PageReader(Tablespace* space, const std::vector<uint32_t>* pages_no,
+             uint32_t queue_depth);
+  ~PageReader();
+
+  // Returns the next page of the list, aligned to the page size. It stays
+  // valid until the following call. Returns nullptr with errno set if the
+  // page can't be read, or if the whole list has been consumed.
+  unsigned char* Next();
+
+  // Number of pages read so far by the I/O threads, including the ones
+  // read ahead but never returned by Next()
+  size_t n_pages_read();
+
+ private:
+  enum SlotState {
+    SLOT_FREE,
+    SLOT_READING,
+    SLOT_READY
+  };
+  struct Slot {
+    unsigned char* buf = nullptr;
+    SlotState state = SLOT_FREE;
+    bool failed = false;
+    int read_errno = 0;
+  };
+
+  void IOThread();
+
+  Tablespace* space_;
+  const std::vector<uint32_t>* pages_no_;
+  uint32_t queue_depth_;
+  unsigned char* bufs_unalign_;
+  std::vector<Slot> slots_;
+  std::vector<std::thread> io_threads_;
+
+  std::mutex mutex_;
+  std::condition_variable issue_cond_;
+  std::condition_variable ready_cond_;
+  // Index in pages_no_ of the next page to be read by an I/O thread
+  size_t next_issue_;
+  // Index in pages_no_ of the next page to be returned by Next()
+  size_t next_consume_;
+  // Whether the page at next_consume_ has been returned and is still used
+  bool holding_;
+  bool stop_;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // PAGEREADER_H_
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "Predicate.h"
+#include "Record.h"
+#include "Column.h"
+#include "FieldValue.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <strings.h>
+
+namespace ibd_ninja {
+
+#define ninja_error(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][ERROR]: " fmt "\n", ##__VA_ARGS__)
+
+// Recursive descent parser of the grammar in Predicate.h, appending the
+// nodes of the expression to nodes_ of the predicate
+class Predicate::Parser {
+ public:
+  Parser(const std::string& expr, const std::vector<Column*>& columns,
+         const std::vector<uint32_t>& fields_no, Predicate* predicate)
+    : expr_(expr), columns_(columns), fields_no_(fields_no),
+      predicate_(predicate) {
+  }
+
+  bool Parse() {
+    if (!Next() || !ParseOr(&predicate_->root_)) {
+      return false;
+    }
+    if (token_ != END) {
+      return Error("unexpected '" + text_ + "'");
+    }
+    return true;
+  }
+
+ private:
+  enum Token { END, IDENT, QUOTED_IDENT, NUMBER, STRING, OP, LPAREN, RPAREN };
+
+  bool Error(const std::string& msg) {
+    ninja_error("Invalid --where expression at offset %zu: %s",
+                token_start_, msg.c_str());
+    return false;
+  }
+
+  // Reads the next token into token_ and text_
+  bool Next() {
+    while (pos_ < expr_.size() && isspace(
+           static_cast<unsigned char>(expr_[pos_]))) {
+      pos_++;
+    }
+    token_start_ = pos_;
+    text_.clear();
+    if (pos_ == expr_.size()) {
+      token_ = END;
+      return true;
+    }
+    char c = expr_[pos_];
+    char next = pos_ + 1 < expr_.size() ? expr_[pos_ + 1] : '\0';
+    if (c == '(' || c == ')') {
+      token_ = c == '(' ? LPAREN : RPAREN;
+      text_ = c;
+      pos_++;
+    } else if (c == '=' || c == '<' || c == '>' || c == '!') {
+      token_ = OP;
+      text_ = c;
+      pos_++;
+      if (next == '=' || (c == '<' && next == '>')) {
+        text_ += next;
+        pos_++;
+      } else if (c == '!') {
+        return Error("expected '!='");
+      }
+    } else if (isdigit(static_cast<unsigned char>(c)) || c == '.' ||
+               ((c == '-' || c == '+') &&
+                (isdigit(static_cast<unsigned char>(next)) || next == '.'))) {
+      const char* start = expr_.c_str() + pos_;
+      char* end = nullptr;
+      number_ = strtold(start, &end);
+      if (end == start) {
+        return Error("invalid number");
+      }
+      token_ = NUMBER;
+      text_.assign(start, end - start);
+      pos_ += end - start;
+    } else if (c == '\'' || c == '"' || c == '`') {
+      // A quote inside is written twice
+      pos_++;
+      while (true) {
+        if (pos_ == expr_.size()) {
+          return Error("unterminated quote");
+        }
+        if (expr_[pos_] == c) {
+          if (pos_ + 1 < expr_.size() && expr_[pos_ + 1] == c) {
+            pos_++;
+          } else {
+            break;
+          }
+        }
+        text_ += expr_[pos_++];
+      }
+      pos_++;
+      token_ = c == '`' ? QUOTED_IDENT : STRING;
+    } else if (isalpha(static_cast<unsigned char>(c)) || c == '_' ||
+               c == '$') {
+      while (pos_ < expr_.size() &&
+             (isalnum(static_cast<unsigned char>(expr_[pos_])) ||
+              expr_[pos_] == '_' || expr_[pos_] == '$')) {
+        text_ += expr_[pos_++];
+      }
+      token_ = IDENT;
+    } else {
+      return Error(std::string("unexpected character '") + c + "'");
+    }
+    return true;
+  }
+
+  bool IsKeyword(const char* keyword) const {
+    return token_ == IDENT && strcasecmp(text_.c_str(), keyword) == 0;
+  }
+
+  uint32_t AddNode(NodeType type, uint32_t left, uint32_t right) {
+    Node node;
+    node.type = type;
+    node.left = left;
+    node.right = right;
+    predicate_->nodes_.push_back(node);
+    return predicate_->nodes_.size() - 1;
+  }
+
+  bool ParseOr(uint32_t* node_no) {
+    if (!ParseAnd(node_no)) {
+      return false;
+    }
+    while (IsKeyword("OR")) {
+      uint32_t right = 0;
+      if (!Next() || !ParseAnd(&right)) {
+        return false;
+      }
+      *node_no = AddNode(OR, *node_no, right);
+    }
+    return true;
+  }
+
+  bool ParseAnd(uint32_t* node_no) {
+    if (!ParseNot(node_no)) {
+      return false;
+    }
+    while (IsKeyword("AND")) {
+      uint32_t right = 0;
+      if (!Next() || !ParseNot(&right)) {
+        return false;
+      }
+      *node_no = AddNode(AND, *node_no, right);
+    }
+    return true;
+  }
+
+  bool ParseNot(uint32_t* node_no) {
+    if (IsKeyword("NOT")) {
+      uint32_t operand = 0;
+      if (!Next() || !ParseNot(&operand)) {
+        return false;
+      }
+      *node_no = AddNode(NOT, operand, 0);
+      return true;
+    }
+    if (token_ == LPAREN) {
+      if (!Next() || !ParseOr(node_no)) {
+        return false;
+      }
+      if (token_ != RPAREN) {
+        return Error("expected ')'");
+      }
+      return Next();
+    }
+    return ParsePredicate(node_no);
+  }
+
+  bool ParsePredicate(uint32_t* node_no) {
+    if ((token_ != IDENT && token_ != QUOTED_IDENT) ||
+        (token_ == IDENT &&
+         (IsKeyword("AND") || IsKeyword("OR") || IsKeyword("NOT") ||
+          IsKeyword("IS") || IsKeyword("NULL")))) {
+      return Error(token_ == END ? "expected a column name" :
+                   "expected a column name instead of '" + text_ + "'");
+    }
+    Node node;
+    for (size_t i = 0; i < columns_.size(); i++) {
+      if (strcasecmp(columns_[i]->name().c_str(), text_.c_str()) == 0) {
+        node.column = columns_[i];
+        node.field_no = fields_no_[i];
+        break;
+      }
+    }
+    if (node.column == nullptr) {
+      return Error("unknown column '" + text_ + "'");
+    }
+    if (!Next()) {
+      return false;
+    }
+
+    if (IsKeyword("IS")) {
+      if (!Next()) {
+        return false;
+      }
+      node.type = IS_NULL;
+      if (IsKeyword("NOT")) {
+        node.type = IS_NOT_NULL;
+        if (!Next()) {
+          return false;
+        }
+      }
+      if (!IsKeyword("NULL")) {
+        return Error("expected NULL");
+      }
+      predicate_->nodes_.push_back(node);
+      *node_no = predicate_->nodes_.size() - 1;
+      return Next();
+    }
+
+    if (token_ != OP) {
+      return Error("expected a comparison operator or IS [NOT] NULL");
+    }
+    node.type = COMPARE;
+    if (text_ == "=") {
+      node.op = EQ;
+    } else if (text_ == "!=" || text_ == "<>") {
+      node.op = NE;
+    } else if (text_ == "<") {
+      node.op = LT;
+    } else if (text_ == "<=") {
+      node.op = LE;
+    } else if (text_ == ">") {
+      node.op = GT;
+    } else if (text_ == ">=") {
+      node.op = GE;
+    } else {
+      return Error("unknown operator '" + text_ + "'");
+    }
+    if (!Next()) {
+      return false;
+    }
+    if (token_ != NUMBER && token_ != STRING) {
+      return Error("expected a number or a quoted string");
+    }
+
+    const std::string& name = node.column->name();
+    switch (DecodedKind(node.column)) {
+      case FieldValue::INT:
+      case FieldValue::UINT:
+      case FieldValue::FLOAT:
+      case FieldValue::DOUBLE:
+        if (token_ != NUMBER) {
+          return Error("column '" + name + "' must be compared with a "
+                       "number");
+        }
+        node.numeric = true;
+        break;
+      case FieldValue::STRING:
+      case FieldValue::BINARY:
+        // DECIMAL is decoded as text, but compared as a number with one
+        node.decimal = token_ == NUMBER &&
+            (node.column->FieldType() == Column::MYSQL_TYPE_NEWDECIMAL ||
+             node.column->FieldType() == Column::MYSQL_TYPE_DECIMAL);
+        if (node.decimal && !NormalizeDecimal(text_, &node.text)) {
+          return Error("column '" + name + "' must be compared with a "
+                       "decimal number");
+        }
+        break;
+      default:
+        return Error("column '" + name + "' can only be tested with "
+                     "IS [NOT] NULL");
+    }
+    node.number = number_;
+    if (!node.decimal) {
+      node.text = text_;
+      if (node.column->IsCharacterString()) {
+        node.collation = Collation(node.column->CollationName());
+      }
+    }
+    predicate_->nodes_.push_back(node);
+    *node_no = predicate_->nodes_.size() - 1;
+    return Next();
+  }
+
+  const std::string& expr_;
+  const std::vector<Column*>& columns_;
+  const std::vector<uint32_t>& fields_no_;
+  Predicate* predicate_;
+
+  size_t pos_ = 0;
+  size_t token_start_ = 0;
+  Token token_ = END;
+  std::string text_;
+  long double number_ = 0;
+};
+
+Predicate* Predicate::Create(const std::string& expr,
+                             const std::vector<Column*>& columns,
+                             const std::vector<uint32_t>& fields_no) {
+  Predicate* predicate = new Predicate();
+  Parser parser(expr, columns, fields_no, predicate);
+  if (!parser.Parse()) {
+    delete predicate;
+    return nullptr;
+  }
+  return predicate;
+}
+
+bool Predicate::Matches(Record* record, std::string* ext_value) const {
+  return Evaluate(root_, record, ext_value) == YES;
+}
+
+Predicate::Truth Predicate::Evaluate(uint32_t node_no, Record* record,
+                                     std::string* ext_value) const {
+  const Node& node = nodes_[node_no];
+  switch (node.type) {
+    case AND: {
+      Truth left = Evaluate(node.left, record, ext_value);
+      if (left == NO) {
+        return NO;
+      }
+      Truth right = Evaluate(node.right, record, ext_value);
+      if (right == NO) {
+        return NO;
+      }
+      return left == YES && right == YES ? YES : UNKNOWN;
+    }
+    case OR: {
+      Truth left = Evaluate(node.left, record, ext_value);
+      if (left == YES) {
+        return YES;
+      }
+      Truth right = Evaluate(node.right, record, ext_value);
+      if (right == YES) {
+        return YES;
+      }
+      return left == NO && right == NO ? NO : UNKNOWN;
+    }
+    case NOT: {
+      Truth operand = Evaluate(node.left, record, ext_value);
+      return operand == UNKNOWN ? UNKNOWN : (operand == YES ? NO : YES);
+    }
+    case IS_NULL:
+    case IS_NOT_NULL: {
+      const unsigned char* data = nullptr;
+      uint32_t len = 0;
+      bool failed = false;
+      // An external value that can't be read is still not NULL
+      bool is_null = !record->GetFieldValue(node.field_no, node.column,
+                                            ext_value, &data, &len,
+                                            &failed) && !failed;
+      return is_null == (node.type == IS_NULL) ? YES : NO;
+    }
+    case COMPARE:
+      return Compare(node, record, ext_value);
+  }
+  return UNKNOWN;
+}
+
+Predicate::Truth Predicate::Compare(const Node& node, Record* record,
+                                    std::string* ext_value) const {
+  const unsigned char* data = nullptr;
+  uint32_t len = 0;
+  bool failed = false;
+  FieldValue value;
+  if (!record->GetFieldValue(node.field_no, node.column, ext_value, &data,
+                             &len, &failed) ||
+      !node.column->Decode(data, len, &value)) {
+    return UNKNOWN;
+  }
+
+  int cmp = 0;
+  if (node.numeric) {
+    if (!CompareNumber(value, node.number, &cmp)) {
+      return UNKNOWN;
+    }
+  } else if (node.decimal) {
+    if (!CompareDecimal(value, node.text, &cmp)) {
+      return UNKNOWN;
+    }
+  } else {
+    bool approximated = false;
+    cmp = node.collation.CompareApproximately(value.str, value.len,
+                                              node.text.data(),
+                                              node.text.size(),
+                                              &approximated);
+  }
+
+  bool result = false;
+  switch (node.op) {
+    case EQ:
+      result = cmp == 0;
+      break;
+    case NE:
+      result = cmp != 0;
+      break;
+    case LT:
+      result = cmp < 0;
+      break;
+    case LE:
+      result = cmp <= 0;
+      break;
+    case GT:
+      result = cmp > 0;
+      break;
+    case GE:
+      result = cmp >= 0;
+      break;
+  }
+  return result ? YES : NO;
+}
+
+}  // namespace ibd_ninja
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef PREDICATE_H_
+#define PREDICATE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Collation.h"
+
+namespace ibd_ninja {
+
+class Column;
+class Record;
+
+// A --where expression compiled against the columns of a table, evaluated
+// on the leaf records of its clustered index. The grammar is:
+//
+//   expr       := and_expr (OR and_expr)*
+//   and_expr   := not_expr (AND not_expr)*
+//   not_expr   := NOT not_expr | '(' expr ')' | predicate
+//   predicate  := column (= | != | <> | < | <= | > | >=) literal
+//               | column IS [NOT] NULL
+//   literal    := number | 'string' | "string"
+//
+// Keywords and column names are case-insensitive, column names may be
+// quoted with backticks. Integer and floating point columns are compared
+// as numbers, at the precision of the column, and DECIMAL columns exactly,
+// digit by digit, when the literal is a number. CHAR, VARCHAR and TEXT
+// columns are compared with the text of the literal by their collation, as
+// --lookup compares keys, approximately if the collation can't compare the
+// text exactly. All other columns are compared byte by byte with it, i.e.
+// the formatted value of temporal types and the raw bytes of binary
+// strings. JSON and VECTOR columns can only be tested with IS NULL.
+// As in SQL, a comparison with NULL is neither true nor false, and such
+// records don't match.
+//
+// Only the fields the expression refers to are decoded, and AND/OR stop
+// at the first operand that decides the result.
+class Predicate {
+ public:
+  // columns and fields_no are the columns that can be referred to and
+  // their field numbers in the records. Returns nullptr if expr is not
+  // valid, after printing why.
+  static Predicate* Create(const std::string& expr,
+                           const std::vector<Column*>& columns,
+                           const std::vector<uint32_t>& fields_no);
+
+  // GetColumnOffsets must have been called on record. ext_value is reused
+  // for the whole value of external fields.
+  bool Matches(Record* record, std::string* ext_value) const;
+
+ private:
+  enum Truth { NO, YES, UNKNOWN };
+  enum NodeType { AND, OR, NOT, COMPARE, IS_NULL, IS_NOT_NULL };
+  enum CompareOp { EQ, NE, LT, LE, GT, GE };
+  struct Node {
+    NodeType type;
+    // Operands of AND, OR and NOT
+    uint32_t left = 0;
+    uint32_t right = 0;
+    // Column and field of COMPARE, IS_NULL and IS_NOT_NULL
+    Column* column = nullptr;
+    uint32_t field_no = 0;
+    CompareOp op = EQ;
+    // Compare as numbers with number, DECIMAL digit by digit with the
+    // digits in text, otherwise with text by collation, which is binary
+    // for the values that are not character strings
+    bool numeric = false;
+    bool decimal = false;
+    long double number = 0;
+    std::string text;
+    Collation collation;
+  };
+  class Parser;
+
+  Predicate() = default;
+  Truth Evaluate(uint32_t node_no, Record* record,
+                 std::string* ext_value) const;
+  Truth Compare(const Node& node, Record* record,
+                std::string* ext_value) const;
+
+  std::vector<Node> nodes_;
+  uint32_t root_ = 0;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // PREDICATE_H_
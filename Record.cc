@@ -5,6 +5,7 @@
 #include "Index.h"
 #include "Table.h"
 #include "Column.h"
+#include "Output.h"
 
 #include <cassert>
 #include <cinttypes>
@@ -17,6 +18,219 @@ namespace ibd_ninja {
 
 #define UT_BITS_IN_BYTES(b) (((b) + 7UL) / 8UL)
 
+/* ------ LengthHistogram ------ */
+uint32_t LengthHistogram::BucketOf(uint32_t len) {
+  if (len < 4) {
+    return len;
+  }
+  uint32_t exp = 31 - __builtin_clz(len);
+  uint32_t bucket = (exp - 1) * 4 + ((len >> (exp - 2)) & 3);
+  return bucket < N_BUCKETS ? bucket : N_BUCKETS - 1;
+}
+
+uint32_t LengthHistogram::BucketLow(uint32_t bucket) {
+  if (bucket < 4) {
+    return bucket;
+  }
+  return (4 + bucket % 4) << (bucket / 4 - 1);
+}
+
+uint32_t LengthHistogram::BucketHigh(uint32_t bucket) {
+  if (bucket == N_BUCKETS - 1) {
+    return UINT32_MAX;
+  }
+  return BucketLow(bucket + 1) - 1;
+}
+
+void LengthHistogram::Merge(const LengthHistogram& other, uint64_t weight) {
+  if (other.n_values == 0) {
+    return;
+  }
+  for (uint32_t i = 0; i < N_BUCKETS; i++) {
+    buckets[i] += other.buckets[i] * weight;
+  }
+  n_values += other.n_values * weight;
+  sum += other.sum * weight;
+  if (other.max > max) {
+    max = other.max;
+  }
+}
+
+void LengthHistogram::Divide(uint64_t n) {
+  // max is kept, it is the longest length seen
+  n_values = 0;
+  for (uint32_t i = 0; i < N_BUCKETS; i++) {
+    buckets[i] = (buckets[i] + n / 2) / n;
+    n_values += buckets[i];
+  }
+  sum = (sum + n / 2) / n;
+}
+
+uint32_t LengthHistogram::Percentile(double p) const {
+  if (n_values == 0) {
+    return 0;
+  }
+  uint64_t rank = static_cast<uint64_t>(p * n_values + 0.5);
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < N_BUCKETS; i++) {
+    count += buckets[i];
+    if (count >= rank && count > 0) {
+      return BucketHigh(i) < max ? BucketHigh(i) : max;
+    }
+  }
+  return max;
+}
+
+/* ------ PageAnalysisResult ------ */
+void PageAnalysisResult::Merge(const PageAnalysisResult& other,
+                               uint64_t weight) {
+  n_recs_non_leaf += other.n_recs_non_leaf * weight;
+  n_recs_leaf += other.n_recs_leaf * weight;
+  headers_len_non_leaf += other.headers_len_non_leaf * weight;
+  headers_len_leaf += other.headers_len_leaf * weight;
+  recs_len_non_leaf += other.recs_len_non_leaf * weight;
+  recs_len_leaf += other.recs_len_leaf * weight;
+  n_deleted_recs_non_leaf += other.n_deleted_recs_non_leaf * weight;
+  n_deleted_recs_leaf += other.n_deleted_recs_leaf * weight;
+  deleted_recs_len_non_leaf += other.deleted_recs_len_non_leaf * weight;
+  deleted_recs_len_leaf += other.deleted_recs_len_leaf * weight;
+  n_contain_dropped_cols_recs_non_leaf +=
+    other.n_contain_dropped_cols_recs_non_leaf * weight;
+  n_contain_dropped_cols_recs_leaf +=
+    other.n_contain_dropped_cols_recs_leaf * weight;
+  dropped_cols_len_non_leaf += other.dropped_cols_len_non_leaf * weight;
+  dropped_cols_len_leaf += other.dropped_cols_len_leaf * weight;
+  innodb_internal_used_non_leaf +=
+    other.innodb_internal_used_non_leaf * weight;
+  innodb_internal_used_leaf += other.innodb_internal_used_leaf * weight;
+  free_non_leaf += other.free_non_leaf * weight;
+  free_leaf += other.free_leaf * weight;
+  n_lob_fields += other.n_lob_fields * weight;
+  n_lob_pages += other.n_lob_pages * weight;
+  lob_data_len += other.lob_data_len * weight;
+  for (uint32_t i = 0; i <= MAX_ROW_VERSION; i++) {
+    row_versions[i].Merge(other.row_versions[i], weight);
+  }
+  for (uint32_t i = 0; i < REC_N_INSERT_STATES; i++) {
+    insert_states[i].Merge(other.insert_states[i], weight);
+  }
+  rec_lens_leaf.Merge(other.rec_lens_leaf, weight);
+  headers_lens_leaf.Merge(other.headers_lens_leaf, weight);
+  if (other.field_lens_leaf.size() > field_lens_leaf.size()) {
+    field_lens_leaf.resize(other.field_lens_leaf.size());
+  }
+  for (size_t i = 0; i < other.field_lens_leaf.size(); i++) {
+    field_lens_leaf[i].Merge(other.field_lens_leaf[i], weight);
+  }
+}
+
+void PageAnalysisResult::Divide(uint64_t n) {
+  uint64_t* counters[] = {
+    &n_recs_non_leaf, &n_recs_leaf,
+    &headers_len_non_leaf, &headers_len_leaf,
+    &recs_len_non_leaf, &recs_len_leaf,
+    &n_deleted_recs_non_leaf, &n_deleted_recs_leaf,
+    &deleted_recs_len_non_leaf, &deleted_recs_len_leaf,
+    &n_contain_dropped_cols_recs_non_leaf, &n_contain_dropped_cols_recs_leaf,
+    &dropped_cols_len_non_leaf, &dropped_cols_len_leaf,
+    &innodb_internal_used_non_leaf, &innodb_internal_used_leaf,
+    &free_non_leaf, &free_leaf,
+    &n_lob_fields, &n_lob_pages, &lob_data_len
+  };
+  for (uint64_t* counter : counters) {
+    *counter = (*counter + n / 2) / n;
+  }
+  for (uint32_t i = 0; i <= MAX_ROW_VERSION; i++) {
+    row_versions[i].Divide(n);
+  }
+  for (uint32_t i = 0; i < REC_N_INSERT_STATES; i++) {
+    insert_states[i].Divide(n);
+  }
+  rec_lens_leaf.Divide(n);
+  headers_lens_leaf.Divide(n);
+  for (auto& field_lens : field_lens_leaf) {
+    field_lens.Divide(n);
+  }
+}
+
+const char* InsertStateString(REC_INSERT_STATE state) {
+  switch (state) {
+    case INSERTED_BEFORE_INSTANT_ADD_OLD_IMPLEMENTATION:
+      return "Before INSTANT ADD (old implementation)";
+    case INSERTED_AFTER_INSTANT_ADD_OLD_IMPLEMENTATION:
+      return "After INSTANT ADD (old implementation)";
+    case INSERTED_AFTER_UPGRADE_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION:
+      return "After upgrade, before INSTANT ADD/DROP";
+    case INSERTED_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION:
+      return "Before INSTANT ADD/DROP";
+    case INSERTED_AFTER_INSTANT_ADD_NEW_IMPLEMENTATION:
+      return "After INSTANT ADD/DROP";
+    case INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION:
+      return "No INSTANT ADD/DROP";
+    default:
+      return "Unknown";
+  }
+}
+
+/* ------ IndexAnalyzeResult ------ */
+void IndexAnalyzeResult::AddPage(uint32_t page_level,
+                                 const PageAnalysisResult* page_result) {
+  if (page_level > 0) {
+    n_pages_non_leaf++;
+  } else {
+    n_pages_leaf++;
+  }
+  if (page_result != nullptr) {
+    recs_result.Merge(*page_result);
+  }
+  // The level comes from the page header, don't trust a corrupted one
+  if (page_level >= BTR_MAX_LEVELS) {
+    return;
+  }
+  if (page_level >= levels.size()) {
+    levels.resize(page_level + 1);
+  }
+  levels[page_level].n_pages++;
+  if (page_result != nullptr) {
+    levels[page_level].recs_result.Merge(*page_result);
+  }
+}
+
+void IndexAnalyzeResult::AddLeafStep(uint32_t prev_page_no,
+                                     uint32_t page_no,
+                                     uint32_t extent_size) {
+  if (prev_page_no == FIL_NULL) {
+    n_leaf_seeks++;
+    return;
+  }
+  if (page_no == prev_page_no + 1) {
+    if (page_no / extent_size != prev_page_no / extent_size) {
+      n_leaf_extent_switches++;
+    }
+    return;
+  }
+  n_leaf_discontinuities++;
+  if (page_no / extent_size != prev_page_no / extent_size) {
+    n_leaf_extent_switches++;
+    n_leaf_seeks++;
+  } else if (page_no < prev_page_no) {
+    n_leaf_seeks++;
+  }
+}
+
+void IndexAnalyzeResult::Merge(const IndexAnalyzeResult& other) {
+  n_pages_non_leaf += other.n_pages_non_leaf;
+  n_pages_leaf += other.n_pages_leaf;
+  recs_result.Merge(other.recs_result);
+  if (other.levels.size() > levels.size()) {
+    levels.resize(other.levels.size());
+  }
+  for (size_t i = 0; i < other.levels.size(); i++) {
+    levels[i].n_pages += other.levels[i].n_pages;
+    levels[i].recs_result.Merge(other.levels[i].recs_result);
+  }
+}
+
 /* ------ Record ------ */
 uint32_t Record::GetBitsFrom1B(uint32_t offs, uint32_t mask, uint32_t shift) {
   return ((ReadFrom1B(rec_ - offs) & mask) >> shift);
@@ -53,9 +267,9 @@ uint32_t* Record::GetColumnOffsets() {
   } else {
     // TODO(Zhao): Support redundant row format
   }
+  assert(n <= REC_MAX_N_FIELDS);
   uint32_t size = n + (1 + REC_OFFS_HEADER_SIZE);
-  assert(offsets_ == nullptr);
-  offsets_ = new uint32_t[size];
+  assert(GetNAlloc() == 0);
   SetNAlloc(size);
   SetNFields(n);
   InitColumnOffsets();
@@ -171,74 +385,70 @@ void Record::InitColumnOffsetsCompactLeaf() {
   rec_insert_state = InitNullAndLengthCompact(&nulls, &lens, &n_null,
                                  &non_default_fields, &row_version);
 
-  uint32_t offs = 0;
-  uint32_t any_ext = 0;
-  uint32_t null_mask = 1;
-  uint16_t i = 0;
-  do {
-    IndexColumn* index_col = index_->GetPhysicalField(i);
-    Column* col = index_col->column();
-    uint64_t len;
-    switch (rec_insert_state) {
-      case INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION:
-        assert(!index_->HasInstantColsOrRowVersions());
-        break;
+  // Whether each field is stored, dropped or instantly added is decided by
+  // the layouts of the row version, and only the old INSTANT ADD
+  // implementation needs the number of fields of the record
+  const FieldLayout* layouts = nullptr;
+  switch (rec_insert_state) {
+    case INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION:
+      assert(!index_->HasInstantColsOrRowVersions());
+      layouts = index_->GetFieldLayouts();
+      break;
 
-      case INSERTED_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION: {
-        assert(row_version == UINT8_UNDEFINED || row_version == 0);
-        assert(index_->ib_row_versions());
-        row_version = 0;
-      }
-      [[fallthrough]];
-      case INSERTED_AFTER_UPGRADE_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION:
-      case INSERTED_AFTER_INSTANT_ADD_NEW_IMPLEMENTATION: {
-        assert(index_->ib_row_versions() ||
-              (index_->table()->ib_m_upgraded_instant() && row_version == 0));
-
-        if (col->IsDroppedInOrBefore(row_version)) {
-          len = offs | REC_OFFS_DROP;
-          goto resolved;
-        } else if (col->IsAddedAfter(row_version)) {
-          len = GetInstantOffset(i, offs);
-          goto resolved;
-        }
-      } break;
+    case INSERTED_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION: {
+      assert(row_version == UINT8_UNDEFINED || row_version == 0);
+      assert(index_->ib_row_versions());
+      row_version = 0;
+    }
+    [[fallthrough]];
+    case INSERTED_AFTER_UPGRADE_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION:
+    case INSERTED_AFTER_INSTANT_ADD_NEW_IMPLEMENTATION:
+      assert(index_->ib_row_versions() ||
+            (index_->table()->ib_m_upgraded_instant() && row_version == 0));
+      layouts = index_->GetFieldLayouts(row_version);
+      break;
 
-      case INSERTED_BEFORE_INSTANT_ADD_OLD_IMPLEMENTATION:
-      case INSERTED_AFTER_INSTANT_ADD_OLD_IMPLEMENTATION: {
-        assert(non_default_fields > 0);
-        assert(index_->ib_instant_cols());
+    case INSERTED_BEFORE_INSTANT_ADD_OLD_IMPLEMENTATION:
+    case INSERTED_AFTER_INSTANT_ADD_OLD_IMPLEMENTATION:
+      assert(non_default_fields > 0);
+      assert(index_->ib_instant_cols());
+      layouts = index_->GetFieldLayouts();
+      break;
 
-        if (i >= non_default_fields) {
-          len = GetInstantOffset(i, offs);
-          goto resolved;
-        }
-      } break;
+    default:
+      assert(false);
+  }
+  insert_state_ = rec_insert_state;
+  row_version_ = row_version;
 
-      default:
-        assert(false);
+  uint32_t offs = 0;
+  uint32_t any_ext = 0;
+  const uint16_t n_fields = static_cast<uint16_t>(RecOffsNFields(offsets_));
+  uint32_t* field_offs = RecOffsBase(offsets_) + 1;
+  for (uint16_t i = 0; i < n_fields; i++) {
+    const FieldLayout& layout = layouts[i];
+    uint32_t len;
+    if (layout.missing) {
+      len = offs | layout.missing;
+      goto resolved;
+    }
+    if (i >= non_default_fields) {
+      len = offs | layout.instant;
+      goto resolved;
     }
 
-    if (col->is_nullable()) {
-      assert(n_null--);
-
-      if (!(unsigned char)null_mask) {
-        nulls--;
-        null_mask = 1;
-      }
-
-      if (*nulls & null_mask) {
-        null_mask <<= 1;
+    if (layout.null_pos != FieldLayout::kNotNullable) {
+      assert(layout.null_pos < n_null);
+      if (*(nulls - (layout.null_pos >> 3)) & (1 << (layout.null_pos & 7))) {
         len = offs | REC_OFFS_SQL_NULL;
         goto resolved;
       }
-      null_mask <<= 1;
     }
 
-    if (!index_col->ib_fixed_len()) {
+    if (!layout.fixed_len) {
       /* Variable-length field: read the length */
       len = *lens--;
-      if (col->IsBigCol()) {
+      if (layout.big_col) {
         if (len & 0x80) {
           len <<= 8;
           len |= *lens--;
@@ -257,16 +467,16 @@ void Record::InitColumnOffsetsCompactLeaf() {
 
       len = offs += len;
     } else {
-      len = offs += index_col->ib_fixed_len();
+      len = offs += layout.fixed_len;
     }
   resolved:
-    RecOffsBase(offsets_)[i + 1] = len;
-  } while (++i < RecOffsNFields(offsets_));
+    field_offs[i] = len;
+  }
 
   *RecOffsBase(offsets_) = (rec_ - (lens + 1)) | REC_OFFS_COMPACT | any_ext;
 }
 
-Record::REC_INSERT_STATE Record::InitNullAndLengthCompact(
+REC_INSERT_STATE Record::InitNullAndLengthCompact(
             const unsigned char** nulls, const unsigned char** lens,
             uint16_t* n_null, uint16_t* non_default_fields,
             uint8_t* row_version) {
@@ -320,7 +530,7 @@ Record::REC_INSERT_STATE Record::InitNullAndLengthCompact(
   return (rec_insert_state);
 }
 
-Record::REC_INSERT_STATE Record::GetInsertState() {
+REC_INSERT_STATE Record::GetInsertState() {
   if (!index_->HasInstantColsOrRowVersions()) {
     return INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION;
   }
@@ -389,19 +599,9 @@ uint32_t Record::GetNFieldsInstant(const uint32_t extra_bytes,
   return (n_fields);
 }
 
-uint64_t Record::GetInstantOffset(uint32_t n, uint64_t offs) {
-  assert(index_->HasInstantColsOrRowVersions());
-  Column* col = index_->GetPhysicalField(n)->column();
-  if (col->ib_instant_default()) {
-    return (offs | REC_OFFS_DEFAULT);
-  } else {
-    return (offs | REC_OFFS_SQL_NULL);
-  }
-}
-
 void Record::ParseRecord(bool leaf, uint32_t row_no,
                          PageAnalysisResult* result,
-                         bool print) {
+                         bool print, OutputWriter* writer) {
   uint32_t n_fields = leaf ? index_->GetNFields() :
                              index_->GetNUniqueInTreeNonleaf() + 1;
   uint32_t header_len = (RecOffsBase(offsets_)[0] & REC_OFFS_MASK);
@@ -425,6 +625,14 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
       result->n_recs_leaf++;
       result->headers_len_leaf += header_len;
       result->recs_len_leaf += rec_len;
+      if (g_size_stats) {
+        result->rec_lens_leaf.Add(header_len + rec_len);
+        result->headers_lens_leaf.Add(header_len);
+        // Sized once for the first record of the page
+        if (result->field_lens_leaf.size() < n_fields) {
+          result->field_lens_leaf.resize(n_fields);
+        }
+      }
     } else {
       result->n_recs_non_leaf++;
       result->headers_len_non_leaf += header_len;
@@ -439,6 +647,9 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
       result->deleted_recs_len_non_leaf += (header_len + rec_len);
     }
   }
+  if (writer != nullptr) {
+    writer->BeginRecord(row_no, deleted, header_len, rec_len);
+  }
   uint32_t start_pos = 0;
   uint32_t len = 0;
   uint32_t end_pos = 0;
@@ -459,6 +670,7 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
   }
   ninja_pt(print, "\n");
   bool dropped_column_counted = false;
+  uint64_t dropped_cols_len = 0;
   for (uint32_t i = 0; i < n_fields; i++) {
     index_col = nullptr;
     if (!leaf && i == n_fields - 1) {
@@ -476,11 +688,15 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
     ninja_pt(print, "              "
                     "Length: %-5u\n",
                     end_pos - start_pos);
+    if (g_size_stats && leaf && !deleted) {
+      result->field_lens_leaf[i].Add(end_pos - start_pos);
+    }
     // TODO(Zhao): handle external part
     if (index_col != nullptr &&
         index_col->column()->IsColumnDropped()) {
       // Only count valid records with non-zero size for dropped columns.
       if (!deleted && !(len & REC_OFFS_DROP)) {
+        dropped_cols_len += (end_pos - start_pos);
         if (leaf) {
           result->dropped_cols_len_leaf += (end_pos - start_pos);
           if (!dropped_column_counted) {
@@ -505,6 +721,10 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
                     index_col->column()->SeTypeString().c_str());
     }
 
+    if (writer != nullptr) {
+      writer->WriteField(i + 1, index_col, &rec_[start_pos],
+                         end_pos - start_pos, len);
+    }
     ninja_pt(print, "              "
                     "Value : ");
     if (len & REC_OFFS_SQL_NULL) {
@@ -528,6 +748,7 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
       start_pos = end_pos;
       continue;
     }
+    const unsigned char* data = &rec_[start_pos];
     count = 0;
     while (start_pos < end_pos) {
       ninja_pt(print, "%02x ", rec_[start_pos]);
@@ -549,12 +770,94 @@ void Record::ParseRecord(bool leaf, uint32_t row_no,
       ninja_pt(print, "\n                      "
               "[EXTERNAL: space=%u, page=%u, version=%u, len=%" PRIu64 "]",
               space_id, ext_page_no, ext_version, ext_len);
-      FetchAndDisplayExternalLob(space_id, ext_page_no, ext_version, ext_len,
-                                 g_lob_output_format,
-                                 g_lob_show_version_history, print);
+      // The LOB chain is only walked when it is displayed or accounted,
+      // the analysis needs nothing but the external reference
+      if (print) {
+        FetchAndDisplayExternalLob(space_, space_id, ext_page_no, ext_version,
+                                   ext_len, g_lob_output_format,
+                                   g_lob_show_version_history, print);
+      }
+      if (g_lob_stats && leaf) {
+        // The pages and bytes of the old versions are both counted
+        uint64_t lob_data_len = ext_len;
+        result->n_lob_fields++;
+        result->n_lob_pages += CountExternalLobPages(space_, ext_page_no,
+                                                     &lob_data_len);
+        result->lob_data_len += lob_data_len;
+      }
     }
     ninja_pt(print, "\n");
+    // Only the prefix of an external field is stored in the record, and
+    // binary values are already shown in hex
+    if (print && index_col != nullptr && !(len & REC_OFFS_EXTERNAL)) {
+      FieldValue value;
+      if (index_col->column()->Decode(data, &rec_[end_pos] - data, &value) &&
+          value.kind != FieldValue::BINARY) {
+        ninja_pt(print, "              "
+                        "Parsed: ");
+        WriteFieldValueText(value, [](const char* str, uint32_t str_len) {
+          fwrite(str, 1, str_len, stdout);
+        });
+        ninja_pt(print, "\n");
+      }
+    }
+  }
+  if (leaf && !deleted && index_->HasInstantColsOrRowVersions() &&
+      insert_state_ != NONE) {
+    RecordGroupStats* stats[2] = {&result->insert_states[insert_state_],
+                                  nullptr};
+    if (row_version_ <= MAX_ROW_VERSION) {
+      stats[1] = &result->row_versions[row_version_];
+    }
+    for (auto* iter : stats) {
+      if (iter != nullptr) {
+        iter->n_recs++;
+        iter->recs_len += header_len + rec_len;
+        iter->dropped_cols_len += dropped_cols_len;
+      }
+    }
+  }
+  if (writer != nullptr) {
+    writer->EndRecord();
+  }
+}
+
+const unsigned char* Record::GetField(uint32_t n, uint32_t* len,
+                                     uint32_t* offs) {
+  assert(n < GetNFields());
+  uint32_t start_pos = (n == 0 ? 0 :
+                        (RecOffsBase(offsets_)[n] & REC_OFFS_MASK));
+  *offs = RecOffsBase(offsets_)[n + 1];
+  *len = (*offs & REC_OFFS_MASK) - start_pos;
+  return &rec_[start_pos];
+}
+
+bool Record::GetFieldValue(uint32_t n, Column* col,
+                           std::string* ext_value,
+                           const unsigned char** data, uint32_t* len,
+                           bool* failed) {
+  uint32_t offs = 0;
+  *failed = false;
+  *data = GetField(n, len, &offs);
+  if (offs & REC_OFFS_DEFAULT) {
+    // Inserted before the column was instantly added
+    if (!col->ib_instant_default()) {
+      return false;
+    }
+    const std::string& value = col->ib_instant_default_value();
+    *data = reinterpret_cast<const unsigned char*>(value.data());
+    *len = value.size();
+  } else if (offs & (REC_OFFS_SQL_NULL | REC_OFFS_DROP)) {
+    return false;
+  } else if (offs & REC_OFFS_EXTERNAL) {
+    if (!FetchExternalField(space_, *data, *len, ext_value)) {
+      *failed = true;
+      return false;
+    }
+    *data = reinterpret_cast<const unsigned char*>(ext_value->data());
+    *len = ext_value->size();
   }
+  return true;
 }
 
 uint32_t Record::GetChildPageNo() {
@@ -8,85 +8,229 @@
 
 #include <cassert>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace ibd_ninja {
 
 class Index;
+class Column;
+class Tablespace;
+class OutputWriter;
+
+// How a record was inserted with regard to INSTANT ADD/DROP COLUMN, which
+// decides how its fields are laid out
+enum REC_INSERT_STATE {
+  INSERTED_BEFORE_INSTANT_ADD_OLD_IMPLEMENTATION,
+  INSERTED_AFTER_INSTANT_ADD_OLD_IMPLEMENTATION,
+  INSERTED_AFTER_UPGRADE_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION,
+  INSERTED_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION,
+  INSERTED_AFTER_INSTANT_ADD_NEW_IMPLEMENTATION,
+  INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION,
+  NONE
+};
+constexpr uint32_t REC_N_INSERT_STATES = NONE;
+const char* InsertStateString(REC_INSERT_STATE state);
+
+// Valid leaf records of one row version or insert state
+struct RecordGroupStats {
+  uint64_t n_recs = 0;
+  uint64_t recs_len = 0;  // headers and bodies
+  uint64_t dropped_cols_len = 0;
+
+  void Merge(const RecordGroupStats& other, uint64_t weight = 1) {
+    n_recs += other.n_recs * weight;
+    recs_len += other.recs_len * weight;
+    dropped_cols_len += other.dropped_cols_len * weight;
+  }
+  void Divide(uint64_t n) {
+    n_recs = (n_recs + n / 2) / n;
+    recs_len = (recs_len + n / 2) / n;
+    dropped_cols_len = (dropped_cols_len + n / 2) / n;
+  }
+};
+
+// Lengths in bytes counted in log-scale buckets: the lengths below 4 have
+// a bucket each, then every power of two range is split into 4 buckets,
+// so a bucket is at most 25% wider than its lower bound. The buckets are a
+// fixed array, adding a length never allocates.
+struct LengthHistogram {
+  static constexpr uint32_t N_BUCKETS = 64;  // up to 128 KB, longer ones
+                                             // fall into the last bucket
+  uint64_t buckets[N_BUCKETS] = {};
+  uint64_t n_values = 0;
+  uint64_t sum = 0;
+  uint32_t max = 0;
+
+  static uint32_t BucketOf(uint32_t len);
+  static uint32_t BucketLow(uint32_t bucket);
+  static uint32_t BucketHigh(uint32_t bucket);
+
+  void Add(uint32_t len) {
+    buckets[BucketOf(len)]++;
+    n_values++;
+    sum += len;
+    if (len > max) {
+      max = len;
+    }
+  }
+  void Merge(const LengthHistogram& other, uint64_t weight = 1);
+  void Divide(uint64_t n);
+  // Upper bound of the bucket holding the length at fraction p of the
+  // values, never above max
+  uint32_t Percentile(double p) const;
+};
 
 struct PageAnalysisResult {
-  uint32_t n_recs_non_leaf = 0;
-  uint32_t n_recs_leaf = 0;
-  uint32_t headers_len_non_leaf = 0;
-  uint32_t headers_len_leaf = 0;
-  uint32_t recs_len_non_leaf = 0;
-  uint32_t recs_len_leaf = 0;
-  uint32_t n_deleted_recs_non_leaf = 0;
-  uint32_t n_deleted_recs_leaf = 0;
-  uint32_t deleted_recs_len_non_leaf = 0;
-  uint32_t deleted_recs_len_leaf = 0;
-  uint32_t n_contain_dropped_cols_recs_non_leaf = 0;  // should always be 0
-  uint32_t n_contain_dropped_cols_recs_leaf = 0;
-  uint32_t dropped_cols_len_non_leaf = 0;  // should always be 0
-  uint32_t dropped_cols_len_leaf = 0;
-  uint32_t innodb_internal_used_non_leaf = 0;
-  uint32_t innodb_internal_used_leaf = 0;
-  uint32_t free_non_leaf = 0;
-  uint32_t free_leaf = 0;
+  uint64_t n_recs_non_leaf = 0;
+  uint64_t n_recs_leaf = 0;
+  uint64_t headers_len_non_leaf = 0;
+  uint64_t headers_len_leaf = 0;
+  uint64_t recs_len_non_leaf = 0;
+  uint64_t recs_len_leaf = 0;
+  uint64_t n_deleted_recs_non_leaf = 0;
+  uint64_t n_deleted_recs_leaf = 0;
+  uint64_t deleted_recs_len_non_leaf = 0;
+  uint64_t deleted_recs_len_leaf = 0;
+  uint64_t n_contain_dropped_cols_recs_non_leaf = 0;  // should always be 0
+  uint64_t n_contain_dropped_cols_recs_leaf = 0;
+  uint64_t dropped_cols_len_non_leaf = 0;  // should always be 0
+  uint64_t dropped_cols_len_leaf = 0;
+  uint64_t innodb_internal_used_non_leaf = 0;
+  uint64_t innodb_internal_used_leaf = 0;
+  uint64_t free_non_leaf = 0;
+  uint64_t free_leaf = 0;
+  // External fields only exist on leaf pages, collected with g_lob_stats
+  uint64_t n_lob_fields = 0;
+  uint64_t n_lob_pages = 0;
+  uint64_t lob_data_len = 0;
+  // Only for the clustered index of a table with instant columns or row
+  // versions. The records of the old INSTANT ADD implementation have no
+  // row version, the ones inserted before the first INSTANT ADD of the
+  // new implementation are of row version 0.
+  RecordGroupStats row_versions[MAX_ROW_VERSION + 1];
+  RecordGroupStats insert_states[REC_N_INSERT_STATES];
+  // Lengths of the valid leaf records, collected with g_size_stats. The
+  // field lengths are the ones stored in the record, indexed by the
+  // physical field number.
+  LengthHistogram rec_lens_leaf;
+  LengthHistogram headers_lens_leaf;
+  std::vector<LengthHistogram> field_lens_leaf;
+
+  // Adds other, counted weight times
+  void Merge(const PageAnalysisResult& other, uint64_t weight = 1);
+  // Divides every counter by n, rounding to the nearest
+  void Divide(uint64_t n);
+};
+
+struct LevelAnalysisResult {
+  uint64_t n_pages = 0;
+  PageAnalysisResult recs_result;
 };
 
 struct IndexAnalyzeResult {
   uint32_t n_level = 0;
-  uint32_t n_pages_non_leaf = 0;
-  uint32_t n_pages_leaf = 0;
+  uint64_t n_pages_non_leaf = 0;
+  uint64_t n_pages_leaf = 0;
+  uint64_t n_pages_read = 0;
   PageAnalysisResult recs_result;
+  // Indexed by the level stored in the page header, 0 is the leaf level
+  std::vector<LevelAnalysisResult> levels;
+  // Number of leaf pages sampled with --sample, 0 if every page was
+  // analyzed. The pages and records are then estimated, and the *_error
+  // members are the half widths of the 95% confidence intervals of some
+  // of the estimates.
+  uint32_t n_sampled_pages = 0;
+  double n_pages_error = 0;
+  double n_pages_leaf_error = 0;
+  double n_recs_leaf_error = 0;
+  double valid_recs_len_leaf_error = 0;
+  double deleted_recs_len_leaf_error = 0;
+  double free_leaf_error = 0;
+  // Physical order of the leaf pages along the FIL_PAGE_NEXT chain, not
+  // collected when sampling. A discontinuity is a next page that is not
+  // the following page of the file. A full scan is estimated to seek once
+  // to its first page, then at every next page that is neither the
+  // following page nor further on in the same extent, which read-ahead
+  // would already have read.
+  uint64_t n_leaf_discontinuities = 0;
+  uint64_t n_leaf_extent_switches = 0;
+  uint64_t n_leaf_seeks = 0;
+
+  // Accounts one page at page_level, page_result is nullptr if the records
+  // of the page could not be parsed
+  void AddPage(uint32_t page_level, const PageAnalysisResult* page_result);
+  // Accounts the step from prev_page_no to page_no along the leaf chain,
+  // prev_page_no is FIL_NULL for the first leaf page
+  void AddLeafStep(uint32_t prev_page_no, uint32_t page_no,
+                   uint32_t extent_size);
+  // Whether the leaf chain was followed, so the n_leaf_* counters are set
+  bool HasLeafChain() const {
+    return n_sampled_pages == 0 && n_leaf_seeks > 0;
+  }
+  // Average number of leaf pages in a run of consecutive ones
+  double LeafAverageRun() const {
+    return static_cast<double>(n_pages_leaf) / (n_leaf_discontinuities + 1);
+  }
+  // Adds the pages and records of other, n_level and n_pages_read are left
+  // to the caller
+  void Merge(const IndexAnalyzeResult& other);
 };
 
 class Record {
  public:
-  Record(const unsigned char* rec, Index* index) :
-    rec_(rec), index_(index), offsets_(nullptr) {
+  Record(const unsigned char* rec, Index* index, Tablespace* space) :
+    rec_(rec), index_(index), space_(space), insert_state_(NONE),
+    row_version_(UINT8_UNDEFINED) {
+    SetNAlloc(0);
   }
-  ~Record() {
-    if (offsets_ != nullptr) {
-      delete [] offsets_;
-    }
+  // Points the record to rec of the same index, so that the object can be
+  // reused. GetColumnOffsets must be called again.
+  void Reset(const unsigned char* rec) {
+    rec_ = rec;
+    insert_state_ = NONE;
+    row_version_ = UINT8_UNDEFINED;
+    SetNAlloc(0);
+  }
+  const unsigned char* rec() const {
+    return rec_;
   }
   uint32_t GetStatus();
   uint32_t* GetColumnOffsets();
   uint32_t GetChildPageNo();
+  // Returns the field n of the record, with its length in len and its end
+  // offset along with the REC_OFFS_* flags in offs. GetColumnOffsets must
+  // be called first.
+  const unsigned char* GetField(uint32_t n, uint32_t* len, uint32_t* offs);
+  // Returns the value of the field n of a leaf record of the clustered
+  // index, which stores col, in data and len: the instant default value of
+  // col if the record was inserted before col was added, the whole value
+  // fetched into ext_value if the field is external. Returns false if the
+  // value is NULL, or with *failed set if the external value can't be read.
+  bool GetFieldValue(uint32_t n, Column* col, std::string* ext_value,
+                     const unsigned char** data, uint32_t* len,
+                     bool* failed);
+  // With writer, the record and its fields are also passed to the writer
   void ParseRecord(bool leaf, uint32_t row_no,
                    PageAnalysisResult* result,
-                   bool print);
+                   bool print, OutputWriter* writer = nullptr);
 
  private:
   uint32_t GetBitsFrom1B(uint32_t offs, uint32_t mask, uint32_t shift);
   uint32_t GetBitsFrom2B(uint32_t offs, uint32_t mask, uint32_t shift);
   void SetNAlloc(uint32_t n_alloc) {
-    assert(offsets_);
     offsets_[0] = n_alloc;
   }
   void SetNFields(uint32_t n_fields) {
-    assert(offsets_);
     offsets_[1] = n_fields;
   }
   uint32_t GetNAlloc() {
-    assert(offsets_);
     return offsets_[0];
   }
   uint32_t GetNFields() {
-    assert(offsets_);
+    assert(GetNAlloc() > 0);
     return offsets_[1];
   }
-  enum REC_INSERT_STATE {
-    INSERTED_BEFORE_INSTANT_ADD_OLD_IMPLEMENTATION,
-    INSERTED_AFTER_INSTANT_ADD_OLD_IMPLEMENTATION,
-    INSERTED_AFTER_UPGRADE_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION,
-    INSERTED_BEFORE_INSTANT_ADD_NEW_IMPLEMENTATION,
-    INSERTED_AFTER_INSTANT_ADD_NEW_IMPLEMENTATION,
-    INSERTED_INTO_TABLE_WITH_NO_INSTANT_NO_VERSION,
-    NONE
-  };
-
   void InitColumnOffsets();
   void InitColumnOffsetsCompact();
   void InitColumnOffsetsCompactLeaf();
@@ -102,10 +246,19 @@ class Record {
   uint32_t GetInfoBits(bool comp);
   uint32_t GetNFieldsInstant(const uint32_t extra_bytes,
                              uint16_t* length);
-  uint64_t GetInstantOffset(uint32_t n, uint64_t offs);
   const unsigned char* rec_;
   Index* index_;
-  uint32_t* offsets_;
+  // Tablespace the record is read from, external fields are fetched from it
+  Tablespace* space_;
+  // Number of used entries (0 until GetColumnOffsets is called), number of
+  // fields, then the header length and the end offset of each field. It is
+  // sized for the most fields a record can have, so that records, which
+  // are created on the stack, never allocate while parsing a page.
+  uint32_t offsets_[REC_OFFS_MAX_SIZE];
+  // Of a leaf record, set by GetColumnOffsets. The row version is
+  // UINT8_UNDEFINED if the layout of the record has none.
+  REC_INSERT_STATE insert_state_;
+  uint8_t row_version_;
 };
 
 }  // namespace ibd_ninja
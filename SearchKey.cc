@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "SearchKey.h"
+#include "Index.h"
+#include "Column.h"
+#include "Record.h"
+#include "FieldValue.h"
+#include "Collation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace ibd_ninja {
+
+#define ninja_error(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][ERROR]: " fmt "\n", ##__VA_ARGS__)
+
+SearchKey* SearchKey::Create(Index* index,
+                             const std::vector<std::string>& values) {
+  if (values.empty()) {
+    ninja_error("No key value is given");
+    return nullptr;
+  }
+  uint32_t n_uniq = index->GetNUniqueInTree();
+  if (values.size() > n_uniq) {
+    ninja_error("Index %s has %u key fields, but %zu values are given",
+                index->name().c_str(), n_uniq, values.size());
+    return nullptr;
+  }
+  SearchKey* key = new SearchKey();
+  for (size_t i = 0; i < values.size(); i++) {
+    Field field;
+    field.column = index->GetPhysicalField(i)->column();
+    field.descending = index->IsFieldDescending(i);
+    field.text = values[i];
+    const std::string& name = field.column->name();
+    bool valid = true;
+    switch (DecodedKind(field.column)) {
+      case FieldValue::INT:
+      case FieldValue::UINT:
+      case FieldValue::FLOAT:
+      case FieldValue::DOUBLE:
+        field.numeric = true;
+        break;
+      case FieldValue::STRING:
+        if (field.column->FieldType() == Column::MYSQL_TYPE_NEWDECIMAL ||
+            field.column->FieldType() == Column::MYSQL_TYPE_DECIMAL) {
+          field.decimal = true;
+        } else if (field.column->FieldType() == Column::MYSQL_TYPE_ENUM ||
+                   field.column->FieldType() == Column::MYSQL_TYPE_SET) {
+          valid = false;
+        } else if (field.column->IsCharacterString()) {
+          field.collation = Collation(field.column->CollationName());
+          if (key->approximated_ == nullptr &&
+              !field.collation.Supports(values[i].data(),
+                                        values[i].size())) {
+            key->approximated_ = field.column;
+          }
+        }
+        break;
+      case FieldValue::BINARY:
+        valid = (field.column->FieldType() != Column::MYSQL_TYPE_GEOMETRY);
+        break;
+      default:
+        valid = false;
+        break;
+    }
+    if (!valid) {
+      ninja_error("Column %s of index %s can't be searched by its type",
+                  name.c_str(), index->name().c_str());
+      delete key;
+      return nullptr;
+    }
+    if (field.numeric) {
+      const char* start = values[i].c_str();
+      char* end = nullptr;
+      field.number = strtold(start, &end);
+      if (end == start || *end != '\0') {
+        ninja_error("Invalid value of column %s: '%s' is not a number",
+                    name.c_str(), start);
+        delete key;
+        return nullptr;
+      }
+    }
+    if (field.decimal && !NormalizeDecimal(values[i], &field.digits)) {
+      ninja_error("Invalid value of column %s: '%s' is not a number",
+                  name.c_str(), values[i].c_str());
+      delete key;
+      return nullptr;
+    }
+    key->fields_.push_back(field);
+  }
+  return key;
+}
+
+int SearchKey::CompareField(const Field& field, const unsigned char* data,
+                            uint32_t len, Column** approximated) const {
+  FieldValue value;
+  int cmp = 0;
+  if (!field.column->Decode(data, len, &value)) {
+    // Not expected for the stored key of a record, keep it before the key
+    return 1;
+  }
+  if (field.numeric) {
+    if (!CompareNumber(value, field.number, &cmp)) {
+      return 1;
+    }
+    return -cmp;
+  }
+  if (field.decimal) {
+    if (!CompareDecimal(value, field.digits, &cmp)) {
+      return 1;
+    }
+    return -cmp;
+  }
+  bool approximate = false;
+  cmp = field.collation.CompareApproximately(field.text.data(),
+                                             field.text.size(), value.str,
+                                             value.len, &approximate);
+  if (approximate && *approximated == nullptr) {
+    *approximated = field.column;
+  }
+  return cmp;
+}
+
+int SearchKey::Compare(Record* record, Column** approximated) const {
+  if (RecGetBitField1B(record->rec(), REC_NEW_INFO_BITS,
+                       REC_INFO_MIN_REC_FLAG, REC_INFO_BITS_SHIFT)) {
+    return 1;
+  }
+  for (size_t i = 0; i < fields_.size(); i++) {
+    const Field& field = fields_[i];
+    uint32_t len = 0;
+    uint32_t offs = 0;
+    const unsigned char* data = record->GetField(i, &len, &offs);
+    int cmp = 1;
+    if (!(offs & REC_OFFS_SQL_NULL)) {
+      cmp = CompareField(field, data, len, approximated);
+    }
+    if (cmp != 0) {
+      return field.descending ? -cmp : cmp;
+    }
+  }
+  return 0;
+}
+
+std::string SearchKey::ToString() const {
+  std::string str = "(";
+  for (size_t i = 0; i < fields_.size(); i++) {
+    if (i > 0) {
+      str += ", ";
+    }
+    if (fields_[i].numeric || fields_[i].decimal) {
+      str += fields_[i].text;
+    } else {
+      str += "'" + fields_[i].text + "'";
+    }
+  }
+  return str + ")";
+}
+
+KeyMatcher::KeyMatcher(Index* index, uint32_t n_fields)
+  : n_exact_(n_fields) {
+  for (uint32_t i = 0; i < n_fields; i++) {
+    Field field;
+    Column* col = index->GetPhysicalField(i)->column();
+    field.text = col->IsCharacterString();
+    if (field.text) {
+      field.collation = Collation(col->CollationName());
+      if (!field.collation.exact() && n_exact_ == n_fields) {
+        n_exact_ = i;
+      }
+    }
+    fields_.push_back(field);
+  }
+}
+
+uint32_t KeyMatcher::MatchedFields(Record* a, Record* b,
+                                   uint32_t* n_exact) const {
+  uint32_t n = 0;
+  for (; n < fields_.size(); n++) {
+    const Field& field = fields_[n];
+    uint32_t a_len = 0;
+    uint32_t a_offs = 0;
+    uint32_t b_len = 0;
+    uint32_t b_offs = 0;
+    const unsigned char* a_data = a->GetField(n, &a_len, &a_offs);
+    const unsigned char* b_data = b->GetField(n, &b_len, &b_offs);
+    bool a_null = (a_offs & REC_OFFS_SQL_NULL);
+    bool b_null = (b_offs & REC_OFFS_SQL_NULL);
+    if (a_null || b_null) {
+      // NULLs are equal to each other, as with innodb_stats_method
+      // nulls_equal
+      if (a_null != b_null) {
+        break;
+      }
+      continue;
+    }
+    if (field.text) {
+      bool approximate = false;
+      int cmp = field.collation.CompareApproximately(
+          reinterpret_cast<const char*>(a_data), a_len,
+          reinterpret_cast<const char*>(b_data), b_len, &approximate);
+      if (approximate && n < *n_exact) {
+        *n_exact = n;
+      }
+      if (cmp != 0) {
+        break;
+      }
+    } else if (a_len != b_len ||
+               (a_len > 0 && memcmp(a_data, b_data, a_len) != 0)) {
+      break;
+    }
+  }
+  return n;
+}
+
+}  // namespace ibd_ninja
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef SEARCHKEY_H_
+#define SEARCHKEY_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Collation.h"
+
+namespace ibd_ninja {
+
+class Column;
+class Index;
+class Record;
+
+// A key given on the command line, with a value for each of the first
+// fields of an index, compared with the node pointers and leaf records of
+// the index in the order InnoDB sorts them:
+//
+// - Integer and floating point values as numbers, DECIMAL values exactly,
+//   digit by digit
+// - Character data by the collation of the column, approximately where
+//   Collation can't compare it exactly
+// - Binary strings byte by byte, temporal values as their text
+// - NULL before any value, and everything reversed for DESC fields
+//
+// ENUM, SET, JSON, VECTOR and geometry fields can't be part of a key.
+// Since the index isn't sorted by the approximate order, a key that is
+// compared approximately can't be searched by descending the index.
+class SearchKey {
+ public:
+  // Returns nullptr if values are not valid for the first fields of index,
+  // after printing why
+  static SearchKey* Create(Index* index,
+                           const std::vector<std::string>& values);
+
+  uint32_t n_fields() const {
+    return fields_.size();
+  }
+  // The column of the first value that can't be compared exactly, because
+  // its collation is not known or can't sort it, nullptr if there is none
+  Column* approximated() const {
+    return approximated_;
+  }
+  // Compares the key with the first n_fields() fields of record, which must
+  // be of the index and have its offsets computed. Returns less than, equal
+  // to or greater than 0 as the key is before, equal to or after the
+  // record. The first node pointer of the leftmost page of a level is
+  // before any key. If text is compared approximately, *approximated is
+  // set to its column.
+  int Compare(Record* record, Column** approximated) const;
+  // "(value, ...)"
+  std::string ToString() const;
+
+ private:
+  struct Field {
+    Column* column = nullptr;
+    bool descending = false;
+    // Compared as a number with number, DECIMAL digit by digit with digits,
+    // otherwise as text with text
+    bool numeric = false;
+    long double number = 0;
+    bool decimal = false;
+    std::string digits;
+    std::string text;
+    // Of character data, other text is compared byte by byte
+    Collation collation;
+  };
+
+  SearchKey() = default;
+  int CompareField(const Field& field, const unsigned char* data,
+                   uint32_t len, Column** approximated) const;
+
+  std::vector<Field> fields_;
+  Column* approximated_ = nullptr;
+};
+
+// Tells how many leading fields two records of an index have in common,
+// comparing character data by the collation of its column, approximately
+// where Collation can't compare it exactly, and everything else by its
+// stored bytes, which are the same for equal values
+class KeyMatcher {
+ public:
+  KeyMatcher(Index* index, uint32_t n_fields);
+
+  // The leading fields that are compared exactly, up to the first
+  // character field whose collation Collation doesn't know
+  uint32_t n_exact() const {
+    return n_exact_;
+  }
+  // Both records must have their offsets computed. The fields are all equal
+  // if n_fields is returned. A character field compared approximately
+  // lowers *n_exact to its position.
+  uint32_t MatchedFields(Record* a, Record* b, uint32_t* n_exact) const;
+
+ private:
+  struct Field {
+    bool text = false;
+    Collation collation;
+  };
+
+  std::vector<Field> fields_;
+  uint32_t n_exact_;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // SEARCHKEY_H_
@@ -16,6 +16,19 @@ namespace ibd_ninja {
 
 #define FTS_DOC_ID_COL_NAME "FTS_DOC_ID"
 
+static uint32_t HexDigitValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return 0;
+}
+
 /* ------ Table ------ */
 const std::set<std::string> Table::default_valid_option_keys = {
   "avg_row_length",
@@ -512,7 +525,16 @@ bool Table::InitSeTable() {
         iter->set_ib_instant_default(false);
       } else if (iter->se_private_data().Exists("default")) {
         iter->set_ib_instant_default(true);
-        // TODO(Zhao): parse the default value
+        // The default value is stored as the hex of its bytes in the
+        // record format
+        std::string hex;
+        iter->se_private_data().Get("default", &hex);
+        std::string value(hex.size() / 2, '\0');
+        for (size_t i = 0; i < value.size(); i++) {
+          value[i] = static_cast<char>((HexDigitValue(hex[2 * i]) << 4) |
+                                       HexDigitValue(hex[2 * i + 1]));
+        }
+        iter->set_ib_instant_default_value(value);
       }
     }
   }
@@ -523,6 +545,10 @@ bool Table::InitSeTable() {
     iter->FillIndex(ind);
     ind++;
   }
+  // The fixed lengths of the shared index columns are final only now
+  for (auto* iter : indexes_) {
+    iter->BuildFieldLayouts();
+  }
 
   return true;
 }
@@ -308,6 +308,10 @@ class Table {
   uint32_t ib_n_cols() {
     return ib_n_cols_;
   }
+  // All the columns in the order of the table definition
+  const std::vector<Column*>& columns() const {
+    return columns_;
+  }
   std::vector<Column*>* ib_cols() {
     return &ib_cols_;
   }
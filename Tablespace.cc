@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#include "Tablespace.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace ibd_ninja {
+
+#define ninja_error(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][ERROR]: " fmt "\n", ##__VA_ARGS__)
+#define ninja_warn(fmt, ...) \
+    fprintf(stderr, "[ibdNinja][WARN]: " fmt "\n", ##__VA_ARGS__)
+
+static thread_local uint64_t n_pages_read_by_thread_ = 0;
+
+uint64_t Tablespace::n_pages_read_by_thread() {
+  return n_pages_read_by_thread_;
+}
+
+Tablespace* Tablespace::Open(const char* filename, bool use_mmap) {
+  unsigned char buf[UNIV_ZIP_SIZE_MIN];
+  memset(buf, 0, UNIV_ZIP_SIZE_MIN);
+  struct stat stat_info;
+  if (stat(filename, &stat_info) != 0) {
+    ninja_error("Failed to get file stats: %s, error: %d(%s)",
+            filename, errno, strerror(errno));
+    return nullptr;
+  }
+  uint64_t size = stat_info.st_size;
+  int fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    ninja_error("Failed to open file: %s, error: %d(%s)",
+            filename, errno, strerror(errno));
+    return nullptr;
+  }
+  if (size < UNIV_ZIP_SIZE_MIN) {
+    ninja_error("The file is too small to be a valid ibd file");
+    close(fd);
+    return nullptr;
+  }
+  ssize_t bytes = pread(fd, buf, UNIV_ZIP_SIZE_MIN, 0);
+  if (bytes != UNIV_ZIP_SIZE_MIN) {
+    ninja_error("Failed to read file header: %s, error: %d(%s)",
+            filename, errno, strerror(errno));
+    close(fd);
+    return nullptr;
+  }
+  uint32_t flags = FSPHeaderGetFlags(buf);
+  bool is_valid_flags = FSPFlagsIsValid(flags);
+  uint32_t page_size = 0;
+  uint32_t page_size_shift = 0;
+  if (is_valid_flags) {
+    uint32_t ssize = FSP_FLAGS_GET_PAGE_SSIZE(flags);
+    if (ssize == 0) {
+      page_size = UNIV_PAGE_SIZE_ORIG;
+    } else {
+      page_size = ((UNIV_ZIP_SIZE_MIN >> 1) << ssize);
+    }
+    page_size_shift = PageSizeValidate(page_size);
+  }
+  if (!is_valid_flags || page_size_shift == 0) {
+    ninja_error("Found corruption on page 0 of file %s",
+            filename);
+    close(fd);
+    return nullptr;
+  }
+
+  Tablespace* space = new Tablespace(filename, fd, size);
+  space->flags_ = flags;
+  space->page_size_shift_ = page_size_shift;
+  space->page_logical_size_ = page_size;
+
+  assert(space->page_logical_size_ <= UNIV_PAGE_SIZE_MAX);
+  assert(space->page_logical_size_ <= (1 << PAGE_SIZE_T_SIZE_BITS));
+
+  uint32_t ssize = FSP_FLAGS_GET_ZIP_SSIZE(flags);
+
+  if (ssize == 0) {
+    space->page_compressed_ = false;
+    space->page_physical_size_ = space->page_logical_size_;
+  } else {
+    space->page_compressed_ = true;
+
+    space->page_physical_size_ = ((UNIV_ZIP_SIZE_MIN >> 1) << ssize);
+
+    assert(space->page_physical_size_ <= UNIV_ZIP_SIZE_MAX);
+    assert(space->page_physical_size_ <= (1 << PAGE_SIZE_T_SIZE_BITS));
+  }
+  space->n_pages_ = size / space->page_physical_size_;
+
+  if (use_mmap &&
+      !space->Map(static_cast<uint64_t>(space->n_pages_) *
+                  space->page_physical_size_)) {
+    ninja_warn("Falling back to pread");
+  }
+  return space;
+}
+
+Tablespace::~Tablespace() {
+  Unmap();
+  close(fd_);
+}
+
+ssize_t Tablespace::ReadPage(uint32_t page_no, unsigned char* buf) {
+  assert(buf != nullptr);
+  memset(buf, 0, page_physical_size_);
+  off_t offset = static_cast<off_t>(page_no) * page_physical_size_;
+  n_pages_read_by_thread_++;
+  if (mmap_base_ != nullptr) {
+    if (static_cast<uint64_t>(offset) + page_physical_size_ > mmap_size_) {
+      return 0;
+    }
+    memcpy(buf, mmap_base_ + offset, page_physical_size_);
+    return page_physical_size_;
+  }
+  ssize_t n_bytes_read = pread(fd_, buf, page_physical_size_, offset);
+
+  // TODO(Zhao): Support compressed page
+  return n_bytes_read;
+}
+
+unsigned char* Tablespace::GetPage(uint32_t page_no, unsigned char* buf) {
+  if (mmap_base_ != nullptr) {
+    uint64_t offset = static_cast<uint64_t>(page_no) * page_physical_size_;
+    if (offset + page_physical_size_ > mmap_size_) {
+      return nullptr;
+    }
+    n_pages_read_by_thread_++;
+    return mmap_base_ + offset;
+  }
+  ssize_t bytes = ReadPage(page_no, buf);
+  if (bytes != page_physical_size_) {
+    return nullptr;
+  }
+  return buf;
+}
+
+unsigned char* Tablespace::GetPages(uint32_t first_page_no,
+                                    uint32_t n_pages, unsigned char* buf) {
+  uint64_t offset = static_cast<uint64_t>(first_page_no) *
+                    page_physical_size_;
+  uint64_t len = static_cast<uint64_t>(n_pages) * page_physical_size_;
+  if (mmap_base_ != nullptr) {
+    if (offset + len > mmap_size_) {
+      return nullptr;
+    }
+    n_pages_read_by_thread_ += n_pages;
+    return mmap_base_ + offset;
+  }
+  ssize_t bytes = pread(fd_, buf, len, offset);
+  n_pages_read_by_thread_ += n_pages;
+  if (bytes != static_cast<ssize_t>(len)) {
+    return nullptr;
+  }
+  return buf;
+}
+
+bool Tablespace::Map(uint64_t map_size) {
+  assert(mmap_base_ == nullptr);
+  if (map_size == 0) {
+    return false;
+  }
+  // mmap only guarantees the alignment of the OS page, but records are
+  // located by aligning their address down to the InnoDB page size, so
+  // reserve enough address space to place the mapping on a page boundary.
+  uint64_t align = page_physical_size_;
+  uint64_t reserve_size = map_size + align;
+  void* reserved = mmap(nullptr, reserve_size, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (reserved == MAP_FAILED) {
+    ninja_warn("Failed to reserve %" PRIu64 " B of address space, "
+               "error: %d(%s)", reserve_size, errno, strerror(errno));
+    return false;
+  }
+  unsigned char* base = static_cast<unsigned char*>(
+                    ut_align(reserved, align));
+  void* mapped = mmap(base, map_size, PROT_READ, MAP_SHARED | MAP_FIXED,
+                      fd_, 0);
+  if (mapped == MAP_FAILED) {
+    ninja_warn("Failed to map the tablespace, error: %d(%s)",
+               errno, strerror(errno));
+    munmap(reserved, reserve_size);
+    return false;
+  }
+
+  // Give back the unused head and tail of the reservation
+  unsigned char* reserved_start = static_cast<unsigned char*>(reserved);
+  unsigned char* reserved_end = reserved_start + reserve_size;
+  if (base > reserved_start) {
+    munmap(reserved_start, base - reserved_start);
+  }
+  unsigned char* tail = static_cast<unsigned char*>(
+                    ut_align(base + map_size, sysconf(_SC_PAGESIZE)));
+  if (reserved_end > tail) {
+    munmap(tail, reserved_end - tail);
+  }
+
+  mmap_base_ = base;
+  mmap_size_ = map_size;
+  return true;
+}
+
+void Tablespace::Unmap() {
+  if (mmap_base_ != nullptr) {
+    munmap(mmap_base_, mmap_size_);
+    mmap_base_ = nullptr;
+    mmap_size_ = 0;
+  }
+}
+
+void Tablespace::AdvisePages(uint32_t first_page_no, uint32_t n_pages,
+                             int advice) {
+  if (mmap_base_ == nullptr || n_pages == 0) {
+    return;
+  }
+  uint64_t offset = static_cast<uint64_t>(first_page_no) *
+                    page_physical_size_;
+  if (offset >= mmap_size_) {
+    return;
+  }
+  uint64_t len = std::min<uint64_t>(
+                    static_cast<uint64_t>(n_pages) * page_physical_size_,
+                    mmap_size_ - offset);
+  // madvise needs an OS page aligned address
+  unsigned char* start = static_cast<unsigned char*>(
+                    ut_align_down(mmap_base_ + offset,
+                                  sysconf(_SC_PAGESIZE)));
+  len += (mmap_base_ + offset) - start;
+  madvise(start, len, advice);
+}
+
+}  // namespace ibd_ninja
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+#ifndef TABLESPACE_H_
+#define TABLESPACE_H_
+
+#include "ibdUtils.h"
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+
+namespace ibd_ninja {
+
+// An opened .ibd file: its descriptor, page sizes and optional read-only
+// mapping. Every page access goes through the tablespace it belongs to, so
+// several tablespaces can be opened in one process and read from any
+// number of threads at the same time.
+class Tablespace {
+ public:
+  // Opens the file and validates the page size stored in the FSP header of
+  // page 0. With use_mmap the file is also mapped, falling back to pread()
+  // if that fails. Returns nullptr if the file can't be opened.
+  static Tablespace* Open(const char* filename, bool use_mmap);
+  ~Tablespace();
+
+  const std::string& filename() const {
+    return filename_;
+  }
+  int fd() const {
+    return fd_;
+  }
+  uint64_t file_size() const {
+    return file_size_;
+  }
+  uint32_t flags() const {
+    return flags_;
+  }
+  uint32_t page_size_shift() const {
+    return page_size_shift_;
+  }
+  uint32_t page_logical_size() const {
+    return page_logical_size_;
+  }
+  uint32_t page_physical_size() const {
+    return page_physical_size_;
+  }
+  bool page_compressed() const {
+    return page_compressed_;
+  }
+  uint32_t n_pages() const {
+    return n_pages_;
+  }
+  // Number of pages in an extent, and the size of an extent descriptor
+  uint32_t extent_size() const {
+    return FSPExtentSize(page_logical_size_);
+  }
+  uint32_t xdes_size() const {
+    return XDESSize(page_logical_size_);
+  }
+  bool mapped() const {
+    return mmap_base_ != nullptr;
+  }
+  // Number of pages read so far by the calling thread, from any
+  // tablespace. A walk takes the difference before and after it, which
+  // stays exact while other threads read the same file.
+  static uint64_t n_pages_read_by_thread();
+
+  ssize_t ReadPage(uint32_t page_no, unsigned char* buf);
+  // Returns the page, which points into the mapping when the tablespace is
+  // mapped (--mmap), otherwise it is read into buf. buf must be aligned to
+  // the page size. Returns nullptr if the page can't be read.
+  unsigned char* GetPage(uint32_t page_no, unsigned char* buf);
+  // Same as GetPage, but for n_pages consecutive pages read at once
+  unsigned char* GetPages(uint32_t first_page_no, uint32_t n_pages,
+                          unsigned char* buf);
+  // madvise() the given pages of the mapping, no-op without --mmap
+  void AdvisePages(uint32_t first_page_no, uint32_t n_pages, int advice);
+
+ private:
+  Tablespace(const char* filename, int fd, uint64_t file_size)
+    : filename_(filename), fd_(fd), file_size_(file_size), flags_(0),
+      page_size_shift_(0), page_logical_size_(0), page_physical_size_(0),
+      page_compressed_(false), n_pages_(0), mmap_base_(nullptr),
+      mmap_size_(0) {
+  }
+  bool Map(uint64_t map_size);
+  void Unmap();
+
+  std::string filename_;
+  int fd_;
+  uint64_t file_size_;
+  uint32_t flags_;
+  uint32_t page_size_shift_;
+  uint32_t page_logical_size_;
+  uint32_t page_physical_size_;
+  bool page_compressed_;
+  uint32_t n_pages_;
+  unsigned char* mmap_base_;
+  uint64_t mmap_size_;
+};
+
+}  // namespace ibd_ninja
+
+#endif  // TABLESPACE_H_
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) [2025-2026] [Zhao Song]
+ */
+
+// Measures how fast the field offsets of the records in the leaf pages of a
+// table's clustered index are computed. The leaf pages are read into memory
+// once, then Record::GetColumnOffsets() is run over all their records for
+// the given number of iterations, so that only the record parsing is timed.
+// The heap allocations made while parsing are counted, both by that loop
+// and by ibdNinja::ParsePage() over the same pages, which should make
+// none.
+//
+// Usage: bench_records IBD_FILE TABLE_ID [ITERATIONS]
+
+#include "ibdNinja.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+using namespace ibd_ninja;
+
+static uint64_t g_n_allocs = 0;
+
+void* operator new(size_t size) {
+  g_n_allocs++;
+  void* ptr = malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s IBD_FILE TABLE_ID [ITERATIONS]\n", argv[0]);
+    return 1;
+  }
+  uint64_t table_id = strtoull(argv[2], nullptr, 10);
+  uint64_t iterations = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1000000;
+
+  ibdNinja* ninja = ibdNinja::CreateNinja(argv[1], false);
+  if (ninja == nullptr) {
+    return 1;
+  }
+  Table* table = ninja->GetTable(table_id);
+  if (table == nullptr || table->clust_index() == nullptr ||
+      !table->clust_index()->IsIndexParsingRecSupported() ||
+      ninja->space()->page_compressed()) {
+    fprintf(stderr, "Table %" PRIu64 " can't be parsed\n", table_id);
+    delete ninja;
+    return 1;
+  }
+  Index* index = table->clust_index();
+  Tablespace* space = ninja->space();
+  uint32_t page_size = space->page_physical_size();
+
+  // Keep a copy of every leaf page of the index, aligned to the page size
+  // as the next record offsets are computed from the page alignment
+  std::vector<unsigned char> buf_unalign(2 * page_size);
+  unsigned char* buf = static_cast<unsigned char*>(
+                  ut_align(buf_unalign.data(), page_size));
+  std::vector<uint32_t> leaf_pages_no;
+  for (uint32_t page_no = 0; page_no < space->n_pages(); page_no++) {
+    unsigned char* page = space->GetPage(page_no, buf);
+    if (page != nullptr &&
+        ReadFrom2B(page + FIL_PAGE_TYPE) == FIL_PAGE_INDEX &&
+        ReadFrom8B(page + PAGE_HEADER + PAGE_INDEX_ID) == index->ib_id() &&
+        ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL) == 0) {
+      leaf_pages_no.push_back(page_no);
+    }
+  }
+  std::vector<unsigned char> pages_unalign(
+                  (leaf_pages_no.size() + 1) * page_size);
+  unsigned char* pages = static_cast<unsigned char*>(
+                  ut_align(pages_unalign.data(), page_size));
+  for (size_t i = 0; i < leaf_pages_no.size(); i++) {
+    unsigned char* page = space->GetPage(leaf_pages_no[i], buf);
+    memcpy(pages + i * page_size, page, page_size);
+  }
+
+  std::vector<const unsigned char*> recs;
+  for (size_t i = 0; i < leaf_pages_no.size(); i++) {
+    const unsigned char* page = pages + i * page_size;
+    const unsigned char* rec = page + PAGE_NEW_INFIMUM;
+    while (true) {
+      uint32_t next = RecGetNextOffs(rec, true, space->page_logical_size());
+      if (next == 0 || next >= page_size) {
+        break;
+      }
+      rec = page + next;
+      if (RecGetType(rec) == REC_STATUS_SUPREMUM) {
+        break;
+      }
+      recs.push_back(rec);
+    }
+  }
+  if (recs.empty()) {
+    fprintf(stderr, "Table %" PRIu64 " has no records\n", table_id);
+    delete ninja;
+    return 1;
+  }
+
+  uint64_t checksum = 0;
+  uint64_t n_allocs_start = g_n_allocs;
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; i++) {
+    for (auto* rec : recs) {
+      Record record(rec, index, space);
+      uint32_t* offsets = record.GetColumnOffsets();
+      checksum += offsets[REC_OFFS_HEADER_SIZE + offsets[1]];
+    }
+  }
+  double seconds = std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start).count();
+  uint64_t n_allocs = g_n_allocs - n_allocs_start;
+
+  PageAnalysisResult result;
+  n_allocs_start = g_n_allocs;
+  for (size_t i = 0; i < leaf_pages_no.size(); i++) {
+    ninja->ParsePage(leaf_pages_no[i], pages + i * page_size, &result,
+                     false, false);
+  }
+  uint64_t n_page_allocs = g_n_allocs - n_allocs_start;
+
+  uint64_t n_recs = iterations * recs.size();
+  fprintf(stdout, "Table:                                            "
+                  "%s.%s\n", table->schema_ref().c_str(),
+                  table->name().c_str());
+  fprintf(stdout, "Leaf pages:                                       "
+                  "%zu\n", leaf_pages_no.size());
+  fprintf(stdout, "Records parsed:                                   "
+                  "%" PRIu64 " (%zu x %" PRIu64 ")\n",
+                  n_recs, recs.size(), iterations);
+  fprintf(stdout, "Elapsed:                                          "
+                  "%.3lf s\n", seconds);
+  fprintf(stdout, "Records/sec:                                      "
+                  "%.0lf\n", seconds > 0 ? n_recs / seconds : 0.0);
+  fprintf(stdout, "Heap allocations:                                 "
+                  "%" PRIu64 "\n", n_allocs);
+  fprintf(stdout, "Heap allocations of ParsePage:                    "
+                  "%" PRIu64 " (%zu pages)\n",
+                  n_page_allocs, leaf_pages_no.size());
+  fprintf(stdout, "Checksum:                                         "
+                  "%" PRIu64 "\n", checksum);
+  delete ninja;
+  return 0;
+}
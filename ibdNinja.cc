@@ -7,21 +7,29 @@
 #include "Column.h"
 #include "Record.h"
 #include "JsonBinary.h"
+#include "PageReader.h"
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <zlib.h>
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cerrno>
 #include <cinttypes>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <random>
 #include <set>
+#include <thread>
 #include <sys/stat.h>
 #include <fstream>
 
@@ -37,6 +45,9 @@ namespace ibd_ninja {
 /* ------ LOB Helpers ------ */
 static constexpr uint32_t LOB_MAX_FETCH_SIZE = 16 * 1024 * 1024;  // 16MB cap
 static constexpr uint32_t LOB_MAX_PAGES_VISITED = 4096;
+// Space accounting walks whole chains without fetching data, only guard
+// against cycles in corrupt chains
+static constexpr uint32_t LOB_MAX_PAGES_COUNTED = 1024 * 1024;
 
 static FilAddr ReadFilAddr(const unsigned char* ptr) {
   FilAddr addr;
@@ -88,34 +99,34 @@ static LobFirstPageHeader ReadLobFirstPageHeader(const unsigned char* page_buf)
   return hdr;
 }
 
-static uint64_t FetchModernUncompLob(uint32_t first_page_no,
+// Copies at most max_len bytes of the LOB into dest_buf
+static uint64_t FetchModernUncompLob(Tablespace* space,
+                                     uint32_t first_page_no,
                                      uint64_t total_length,
+                                     uint64_t max_len,
                                      unsigned char* dest_buf,
                                      bool* error) {
   *error = false;
   unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
   unsigned char data_buf[UNIV_PAGE_SIZE_MAX];
 
-  uint64_t cap = total_length;
-  if (cap > LOB_MAX_FETCH_SIZE) {
-    cap = LOB_MAX_FETCH_SIZE;
-  }
+  uint64_t cap = std::min(total_length, max_len);
 
-  ssize_t bytes = ibdNinja::ReadPage(first_page_no, page_buf);
-  if (bytes != g_page_physical_size) {
+  const unsigned char* page = space->GetPage(first_page_no, page_buf);
+  if (page == nullptr) {
     ninja_error("Failed to read LOB first page: %u", first_page_no);
     *error = true;
     return 0;
   }
 
-  uint16_t page_type = PageGetType(page_buf);
+  uint16_t page_type = PageGetType(page);
   if (page_type != FIL_PAGE_TYPE_LOB_FIRST) {
     ninja_error("Expected LOB_FIRST page type (24), got %u", page_type);
     *error = true;
     return 0;
   }
 
-  LobFirstPageHeader hdr = ReadLobFirstPageHeader(page_buf);
+  LobFirstPageHeader hdr = ReadLobFirstPageHeader(page);
 
   // Data offset on the first page: after the index entry array
   uint32_t first_page_data_offset = FIL_PAGE_DATA + LOB_FIRST_PAGE_INDEX_BEGIN +
@@ -127,20 +138,23 @@ static uint64_t FetchModernUncompLob(uint32_t first_page_no,
 
   // Cache: track the page number of the currently loaded index page
   uint32_t cached_index_page_no = first_page_no;
-  // page_buf already contains the first page
+  // page already points to the first page
+  const unsigned char* data_page = nullptr;
 
   while (!cur_addr.is_null() && bytes_copied < cap) {
-    if (++pages_visited > LOB_MAX_PAGES_VISITED) {
+    // The copy is bounded by cap, only guard against cycles in corrupt
+    // index lists
+    if (++pages_visited > LOB_MAX_PAGES_COUNTED) {
       ninja_error("LOB traversal exceeded max pages limit (%u), "
-                  "possible corruption", LOB_MAX_PAGES_VISITED);
+                  "possible corruption", LOB_MAX_PAGES_COUNTED);
       *error = true;
       break;
     }
 
     // Load the index page if different from cached
     if (cur_addr.page_no != cached_index_page_no) {
-      bytes = ibdNinja::ReadPage(cur_addr.page_no, page_buf);
-      if (bytes != g_page_physical_size) {
+      page = space->GetPage(cur_addr.page_no, page_buf);
+      if (page == nullptr) {
         ninja_error("Failed to read LOB index page: %u", cur_addr.page_no);
         *error = true;
         break;
@@ -148,7 +162,7 @@ static uint64_t FetchModernUncompLob(uint32_t first_page_no,
       cached_index_page_no = cur_addr.page_no;
     }
 
-    LobIndexEntry entry = ReadLobIndexEntry(page_buf + cur_addr.byte_offset);
+    LobIndexEntry entry = ReadLobIndexEntry(page + cur_addr.byte_offset);
 
     const unsigned char* data_src = nullptr;
     uint32_t data_len = entry.data_len;
@@ -161,31 +175,31 @@ static uint64_t FetchModernUncompLob(uint32_t first_page_no,
       // Data is on the first page itself
       // Need to re-read first page if we changed the cached page
       if (cached_index_page_no != first_page_no) {
-        bytes = ibdNinja::ReadPage(first_page_no, data_buf);
-        if (bytes != g_page_physical_size) {
+        data_page = space->GetPage(first_page_no, data_buf);
+        if (data_page == nullptr) {
           ninja_error("Failed to re-read LOB first page: %u", first_page_no);
           *error = true;
           break;
         }
-        data_src = data_buf + first_page_data_offset;
+        data_src = data_page + first_page_data_offset;
       } else {
-        data_src = page_buf + first_page_data_offset;
+        data_src = page + first_page_data_offset;
       }
     } else {
-      bytes = ibdNinja::ReadPage(entry.data_page_no, data_buf);
-      if (bytes != g_page_physical_size) {
+      data_page = space->GetPage(entry.data_page_no, data_buf);
+      if (data_page == nullptr) {
         ninja_error("Failed to read LOB data page: %u", entry.data_page_no);
         *error = true;
         break;
       }
-      uint16_t data_page_type = PageGetType(data_buf);
+      uint16_t data_page_type = PageGetType(data_page);
       if (data_page_type != FIL_PAGE_TYPE_LOB_DATA) {
         ninja_error("Expected LOB_DATA page type (23), got %u on page %u",
                     data_page_type, entry.data_page_no);
         *error = true;
         break;
       }
-      data_src = data_buf + FIL_PAGE_DATA + LOB_DATA_PAGE_DATA_BEGIN;
+      data_src = data_page + FIL_PAGE_DATA + LOB_DATA_PAGE_DATA_BEGIN;
     }
 
     if (dest_buf != nullptr) {
@@ -199,22 +213,23 @@ static uint64_t FetchModernUncompLob(uint32_t first_page_no,
   return bytes_copied;
 }
 
-static void PrintLobVersionHistory(uint32_t first_page_no, bool print) {
+static void PrintLobVersionHistory(Tablespace* space,
+                                   uint32_t first_page_no, bool print) {
   unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
   unsigned char ver_buf[UNIV_PAGE_SIZE_MAX];
 
-  ssize_t bytes = ibdNinja::ReadPage(first_page_no, page_buf);
-  if (bytes != g_page_physical_size) {
+  const unsigned char* page = space->GetPage(first_page_no, page_buf);
+  if (page == nullptr) {
     ninja_error("Failed to read LOB first page for version history: %u",
                 first_page_no);
     return;
   }
 
-  if (PageGetType(page_buf) != FIL_PAGE_TYPE_LOB_FIRST) {
+  if (PageGetType(page) != FIL_PAGE_TYPE_LOB_FIRST) {
     return;
   }
 
-  LobFirstPageHeader hdr = ReadLobFirstPageHeader(page_buf);
+  LobFirstPageHeader hdr = ReadLobFirstPageHeader(page);
   FilAddr cur_addr = hdr.index_list.first;
   uint32_t entry_no = 0;
   uint32_t cached_page_no = first_page_no;
@@ -228,14 +243,14 @@ static void PrintLobVersionHistory(uint32_t first_page_no, bool print) {
     }
 
     if (cur_addr.page_no != cached_page_no) {
-      bytes = ibdNinja::ReadPage(cur_addr.page_no, page_buf);
-      if (bytes != g_page_physical_size) {
+      page = space->GetPage(cur_addr.page_no, page_buf);
+      if (page == nullptr) {
         break;
       }
       cached_page_no = cur_addr.page_no;
     }
 
-    LobIndexEntry entry = ReadLobIndexEntry(page_buf + cur_addr.byte_offset);
+    LobIndexEntry entry = ReadLobIndexEntry(page + cur_addr.byte_offset);
 
     ninja_pt(print, "                      [LOB INDEX ENTRY %u]:\n", entry_no);
     ninja_pt(print, "                        Current (v%u): page=%u, len=%u, "
@@ -247,19 +262,20 @@ static void PrintLobVersionHistory(uint32_t first_page_no, bool print) {
     if (entry.versions.length > 0) {
       FilAddr ver_addr = entry.versions.first;
       uint32_t ver_cached_page_no = 0;
+      const unsigned char* ver_page = nullptr;
       while (!ver_addr.is_null()) {
         if (++pages_visited > LOB_MAX_PAGES_VISITED) {
           break;
         }
         if (ver_addr.page_no != ver_cached_page_no) {
-          bytes = ibdNinja::ReadPage(ver_addr.page_no, ver_buf);
-          if (bytes != g_page_physical_size) {
+          ver_page = space->GetPage(ver_addr.page_no, ver_buf);
+          if (ver_page == nullptr) {
             break;
           }
           ver_cached_page_no = ver_addr.page_no;
         }
         LobIndexEntry old_entry = ReadLobIndexEntry(
-            ver_buf + ver_addr.byte_offset);
+            ver_page + ver_addr.byte_offset);
         ninja_pt(print, "                        Old    (v%u): page=%u, "
                  "len=%u, creator_trx=%" PRIu64 ", modifier_trx=%" PRIu64 "\n",
                  old_entry.lob_version, old_entry.data_page_no,
@@ -274,7 +290,8 @@ static void PrintLobVersionHistory(uint32_t first_page_no, bool print) {
   }
 }
 
-void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
+void FetchAndDisplayExternalLob(Tablespace* space,
+                                uint32_t space_id, uint32_t page_no,
                                 uint32_t version, uint64_t ext_len,
                                 LobOutputFormat format,
                                 bool show_versions, bool print) {
@@ -282,14 +299,14 @@ void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
   (void)version;
 
   unsigned char tmp_buf[UNIV_PAGE_SIZE_MAX];
-  ssize_t bytes = ibdNinja::ReadPage(page_no, tmp_buf);
-  if (bytes != g_page_physical_size) {
+  const unsigned char* first_page = space->GetPage(page_no, tmp_buf);
+  if (first_page == nullptr) {
     ninja_pt(print, "\n                      "
              "[LOB: Failed to read page %u]", page_no);
     return;
   }
 
-  uint16_t page_type = PageGetType(tmp_buf);
+  uint16_t page_type = PageGetType(first_page);
 
   if (page_type == FIL_PAGE_TYPE_LOB_FIRST) {
     uint64_t fetch_len = ext_len;
@@ -303,7 +320,9 @@ void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
     }
 
     bool error = false;
-    uint64_t fetched = FetchModernUncompLob(page_no, ext_len, lob_data, &error);
+    uint64_t fetched = FetchModernUncompLob(space, page_no, ext_len,
+                                            LOB_MAX_FETCH_SIZE, lob_data,
+                                            &error);
 
     if (error) {
       ninja_pt(print, "\n                      "
@@ -314,7 +333,7 @@ void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
 
     switch (format) {
       case LobOutputFormat::SUMMARY_ONLY: {
-        LobFirstPageHeader hdr = ReadLobFirstPageHeader(tmp_buf);
+        LobFirstPageHeader hdr = ReadLobFirstPageHeader(first_page);
         ninja_pt(print, "\n                      "
                  "[LOB SUMMARY: type=LOB_FIRST, lob_version=%u, "
                  "data_len=%u, index_entries=%u, total_ext_len=%" PRIu64 "]",
@@ -346,7 +365,7 @@ void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
     delete[] lob_data;
 
     if (show_versions) {
-      PrintLobVersionHistory(page_no, print);
+      PrintLobVersionHistory(space, page_no, print);
     }
   } else if (page_type == FIL_PAGE_TYPE_BLOB || page_type == FIL_PAGE_SDI_BLOB) {
     ninja_pt(print, "\n                      "
@@ -359,14 +378,205 @@ void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
   }
 }
 
+bool FetchExternalField(Tablespace* space, const unsigned char* data,
+                        uint32_t len, std::string* value) {
+  assert(len >= BTR_EXTERN_FIELD_REF_SIZE);
+  uint32_t prefix_len = len - BTR_EXTERN_FIELD_REF_SIZE;
+  const unsigned char* ext_ref = data + prefix_len;
+  uint32_t page_no = ReadFrom4B(ext_ref + BTR_EXTERN_PAGE_NO);
+  uint64_t ext_len = ReadFrom8B(ext_ref + BTR_EXTERN_LEN) & 0x1FFFFFFFFFULL;
+  value->assign(reinterpret_cast<const char*>(data), prefix_len);
+  if (ext_len == 0) {
+    return true;
+  }
+  // No column type holds more than a LONGBLOB
+  if (ext_len > UINT32_MAX) {
+    ninja_error("External field on page %u is %" PRIu64 " bytes long, "
+                "possible corruption", page_no, ext_len);
+    return false;
+  }
+
+  unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
+  const unsigned char* page = space->GetPage(page_no, page_buf);
+  if (page == nullptr) {
+    ninja_error("Failed to read LOB first page: %u", page_no);
+    return false;
+  }
+  uint16_t page_type = PageGetType(page);
+  if (page_type == FIL_PAGE_TYPE_LOB_FIRST) {
+    // The pages are copied one at a time straight into value, which holds
+    // the whole value, so that comparisons and exports see every byte
+    value->resize(prefix_len + ext_len);
+    bool error = false;
+    uint64_t fetched = FetchModernUncompLob(
+        space, page_no, ext_len, ext_len,
+        reinterpret_cast<unsigned char*>(&(*value)[prefix_len]), &error);
+    value->resize(prefix_len + fetched);
+    if (!error && fetched != ext_len) {
+      ninja_error("LOB starting at page %u has %" PRIu64 " of its %" PRIu64
+                  " bytes", page_no, fetched, ext_len);
+      return false;
+    }
+    return !error;
+  }
+  if (page_type != FIL_PAGE_TYPE_BLOB) {
+    ninja_error("Unsupported LOB page type %u (%s) on page %u",
+                page_type, PageType2String(page_type).c_str(), page_no);
+    return false;
+  }
+  // Legacy BLOB: a chain of pages, each with its part length and the next
+  // page number in front of the data
+  uint32_t pages_visited = 0;
+  while (true) {
+    if (++pages_visited > LOB_MAX_PAGES_COUNTED) {
+      ninja_error("BLOB chain starting at page %u is too long, "
+                  "possible corruption",
+                  ReadFrom4B(ext_ref + BTR_EXTERN_PAGE_NO));
+      return false;
+    }
+    uint64_t part_len = std::min<uint64_t>(
+        ReadFrom4B(page + FIL_PAGE_DATA + LOB_HDR_PART_LEN),
+        space->page_physical_size() - FIL_PAGE_DATA - LOB_HDR_SIZE);
+    part_len = std::min<uint64_t>(part_len,
+                                  prefix_len + ext_len - value->size());
+    value->append(reinterpret_cast<const char*>(page + FIL_PAGE_DATA +
+                                                LOB_HDR_SIZE),
+                  part_len);
+    page_no = ReadFrom4B(page + FIL_PAGE_DATA + LOB_HDR_NEXT_PAGE_NO);
+    if (value->size() == prefix_len + ext_len || page_no == FIL_NULL) {
+      break;
+    }
+    page = space->GetPage(page_no, page_buf);
+    if (page == nullptr || PageGetType(page) != FIL_PAGE_TYPE_BLOB) {
+      ninja_error("Failed to read BLOB page: %u", page_no);
+      return false;
+    }
+  }
+  if (value->size() != prefix_len + ext_len) {
+    ninja_error("BLOB starting at page %u has %" PRIu64 " of its %" PRIu64
+                " bytes", ReadFrom4B(ext_ref + BTR_EXTERN_PAGE_NO),
+                static_cast<uint64_t>(value->size() - prefix_len), ext_len);
+    return false;
+  }
+  return true;
+}
+
+uint32_t CountExternalLobPages(Tablespace* space, uint32_t page_no,
+                               uint64_t* data_len) {
+  unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
+  const unsigned char* page = space->GetPage(page_no, page_buf);
+  if (page == nullptr) {
+    ninja_error("Failed to read LOB first page: %u", page_no);
+    return 0;
+  }
+
+  uint16_t page_type = PageGetType(page);
+  if (page_type == FIL_PAGE_TYPE_BLOB || page_type == FIL_PAGE_SDI_BLOB) {
+    // Legacy BLOB: a singly linked list of pages, only the page headers
+    // are needed to follow it
+    uint32_t n_pages = 0;
+    uint32_t curr_page_no = page_no;
+    *data_len = 0;
+    while (true) {
+      if (++n_pages > LOB_MAX_PAGES_COUNTED) {
+        ninja_error("BLOB chain starting at page %u is too long, "
+                    "possible corruption", page_no);
+        break;
+      }
+      *data_len += ReadFrom4B(page + FIL_PAGE_DATA + LOB_HDR_PART_LEN);
+      uint32_t next_page_no = ReadFrom4B(page + FIL_PAGE_DATA +
+                                         LOB_HDR_NEXT_PAGE_NO);
+      if (next_page_no == FIL_NULL) {
+        break;
+      }
+      curr_page_no = next_page_no;
+      page = space->GetPage(curr_page_no, page_buf);
+      if (page == nullptr) {
+        ninja_error("Failed to read BLOB page: %u", curr_page_no);
+        break;
+      }
+    }
+    return n_pages;
+  }
+
+  if (page_type != FIL_PAGE_TYPE_LOB_FIRST) {
+    // TODO(Zhao): Support compressed LOB
+    return 1;
+  }
+
+  // Modern LOB: the index entries of the current and the old versions
+  // reference every data page, so only the first page and the LOB index
+  // pages have to be read. The first page holds data too, so the data
+  // pages are tracked apart to count the bytes of each one once.
+  std::set<uint32_t> pages;
+  std::set<uint32_t> data_pages;
+  pages.insert(page_no);
+  *data_len = 0;
+  LobFirstPageHeader hdr = ReadLobFirstPageHeader(page);
+  unsigned char ver_buf[UNIV_PAGE_SIZE_MAX];
+  const unsigned char* ver_page = nullptr;
+  FilAddr cur_addr = hdr.index_list.first;
+  uint32_t cached_page_no = page_no;
+  uint32_t ver_cached_page_no = FIL_NULL;
+  uint32_t entries_visited = 0;
+  while (!cur_addr.is_null()) {
+    if (++entries_visited > LOB_MAX_PAGES_COUNTED) {
+      break;
+    }
+    if (cur_addr.page_no != cached_page_no) {
+      page = space->GetPage(cur_addr.page_no, page_buf);
+      if (page == nullptr) {
+        ninja_error("Failed to read LOB index page: %u", cur_addr.page_no);
+        break;
+      }
+      cached_page_no = cur_addr.page_no;
+    }
+    pages.insert(cur_addr.page_no);
+    LobIndexEntry entry = ReadLobIndexEntry(page + cur_addr.byte_offset);
+    pages.insert(entry.data_page_no);
+    if (data_pages.insert(entry.data_page_no).second) {
+      *data_len += entry.data_len;
+    }
+
+    FilAddr ver_addr = entry.versions.first;
+    while (!ver_addr.is_null()) {
+      if (++entries_visited > LOB_MAX_PAGES_COUNTED) {
+        break;
+      }
+      if (ver_addr.page_no != ver_cached_page_no) {
+        ver_page = space->GetPage(ver_addr.page_no, ver_buf);
+        if (ver_page == nullptr) {
+          break;
+        }
+        ver_cached_page_no = ver_addr.page_no;
+      }
+      pages.insert(ver_addr.page_no);
+      LobIndexEntry old_entry = ReadLobIndexEntry(
+          ver_page + ver_addr.byte_offset);
+      pages.insert(old_entry.data_page_no);
+      if (data_pages.insert(old_entry.data_page_no).second) {
+        *data_len += old_entry.data_len;
+      }
+      ver_addr = old_entry.next;
+    }
+    cur_addr = entry.next;
+  }
+  if (entries_visited > LOB_MAX_PAGES_COUNTED) {
+    ninja_error("LOB starting at page %u has too many index entries, "
+                "possible corruption", page_no);
+  }
+  return pages.size();
+}
+
 /* ------ Inspect Blob ------ */
 
-static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
+static void PrintLobChainVisualization(Tablespace* space,
+                                       uint32_t first_page_no, bool is_json) {
   unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
   unsigned char ver_buf[UNIV_PAGE_SIZE_MAX];
 
-  ssize_t bytes = ibdNinja::ReadPage(first_page_no, page_buf);
-  if (bytes != g_page_physical_size) {
+  ssize_t bytes = space->ReadPage(first_page_no, page_buf);
+  if (bytes != space->page_physical_size()) {
     ninja_error("Failed to read LOB first page: %u", first_page_no);
     return;
   }
@@ -402,8 +612,8 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
     }
 
     if (cur_addr.page_no != cached_page_no) {
-      bytes = ibdNinja::ReadPage(cur_addr.page_no, page_buf);
-      if (bytes != g_page_physical_size) {
+      bytes = space->ReadPage(cur_addr.page_no, page_buf);
+      if (bytes != space->page_physical_size()) {
         ninja_error("Failed to read LOB index page: %u", cur_addr.page_no);
         break;
       }
@@ -431,8 +641,8 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
       while (!ver_addr.is_null()) {
         if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
         if (ver_addr.page_no != ver_cached_page_no) {
-          bytes = ibdNinja::ReadPage(ver_addr.page_no, ver_buf);
-          if (bytes != g_page_physical_size) break;
+          bytes = space->ReadPage(ver_addr.page_no, ver_buf);
+          if (bytes != space->page_physical_size()) break;
           ver_cached_page_no = ver_addr.page_no;
         }
         LobIndexEntry old_entry = ReadLobIndexEntry(
@@ -461,11 +671,11 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
     cached_page_no = first_page_no;
     pages_visited = 0;
     // Re-read first page since page_buf may have been overwritten
-    ibdNinja::ReadPage(first_page_no, page_buf);
+    space->ReadPage(first_page_no, page_buf);
     while (!cur_addr.is_null()) {
       if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
       if (cur_addr.page_no != cached_page_no) {
-        ibdNinja::ReadPage(cur_addr.page_no, page_buf);
+        space->ReadPage(cur_addr.page_no, page_buf);
         cached_page_no = cur_addr.page_no;
       }
       LobIndexEntry e = ReadLobIndexEntry(page_buf + cur_addr.byte_offset);
@@ -476,7 +686,7 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
         while (!va.is_null()) {
           if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
           if (va.page_no != vc) {
-            ibdNinja::ReadPage(va.page_no, ver_buf);
+            space->ReadPage(va.page_no, ver_buf);
             vc = va.page_no;
           }
           LobIndexEntry oe = ReadLobIndexEntry(ver_buf + va.byte_offset);
@@ -513,7 +723,7 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
       while (!free_addr.is_null()) {
         if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
         if (free_addr.page_no != free_cached_page_no) {
-          ibdNinja::ReadPage(free_addr.page_no, ver_buf);
+          space->ReadPage(free_addr.page_no, ver_buf);
           free_cached_page_no = free_addr.page_no;
         }
         LobIndexEntry fe = ReadLobIndexEntry(ver_buf + free_addr.byte_offset);
@@ -528,7 +738,8 @@ static void PrintLobChainVisualization(uint32_t first_page_no, bool is_json) {
   }
 }
 
-static uint64_t FetchLobByVersion(uint32_t first_page_no,
+static uint64_t FetchLobByVersion(Tablespace* space,
+                                  uint32_t first_page_no,
                                   uint32_t target_version,
                                   unsigned char* dest_buf,
                                   bool* error) {
@@ -537,8 +748,8 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
   unsigned char data_buf[UNIV_PAGE_SIZE_MAX];
   unsigned char ver_buf[UNIV_PAGE_SIZE_MAX];
 
-  ssize_t bytes = ibdNinja::ReadPage(first_page_no, page_buf);
-  if (bytes != g_page_physical_size) {
+  ssize_t bytes = space->ReadPage(first_page_no, page_buf);
+  if (bytes != space->page_physical_size()) {
     ninja_error("Failed to read LOB first page: %u", first_page_no);
     *error = true;
     return 0;
@@ -574,8 +785,8 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
     }
 
     if (cur_addr.page_no != cached_index_page_no) {
-      bytes = ibdNinja::ReadPage(cur_addr.page_no, page_buf);
-      if (bytes != g_page_physical_size) {
+      bytes = space->ReadPage(cur_addr.page_no, page_buf);
+      if (bytes != space->page_physical_size()) {
         *error = true;
         break;
       }
@@ -602,8 +813,8 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
       while (!ver_addr.is_null()) {
         if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
         if (ver_addr.page_no != ver_cached_page_no) {
-          bytes = ibdNinja::ReadPage(ver_addr.page_no, ver_buf);
-          if (bytes != g_page_physical_size) break;
+          bytes = space->ReadPage(ver_addr.page_no, ver_buf);
+          if (bytes != space->page_physical_size()) break;
           ver_cached_page_no = ver_addr.page_no;
         }
         LobIndexEntry old_entry = ReadLobIndexEntry(
@@ -643,8 +854,8 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
 
     if (use_entry.data_page_no == first_page_no) {
       if (cached_index_page_no != first_page_no) {
-        bytes = ibdNinja::ReadPage(first_page_no, data_buf);
-        if (bytes != g_page_physical_size) {
+        bytes = space->ReadPage(first_page_no, data_buf);
+        if (bytes != space->page_physical_size()) {
           *error = true;
           break;
         }
@@ -653,8 +864,8 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
         data_src = page_buf + first_page_data_offset;
       }
     } else {
-      bytes = ibdNinja::ReadPage(use_entry.data_page_no, data_buf);
-      if (bytes != g_page_physical_size) {
+      bytes = space->ReadPage(use_entry.data_page_no, data_buf);
+      if (bytes != space->page_physical_size()) {
         *error = true;
         break;
       }
@@ -682,14 +893,15 @@ static uint64_t FetchLobByVersion(uint32_t first_page_no,
 // Collect all distinct lob_version values visible in the chain.
 // If max_lob_version is non-null, stores hdr.lob_version (the highest version
 // ever assigned, which may be higher than any visible version if purge ran).
-static void CollectLobVersions(uint32_t first_page_no,
+static void CollectLobVersions(Tablespace* space,
+                               uint32_t first_page_no,
                                std::vector<uint32_t>* versions,
                                uint32_t* max_lob_version = nullptr) {
   unsigned char page_buf[UNIV_PAGE_SIZE_MAX];
   unsigned char ver_buf[UNIV_PAGE_SIZE_MAX];
 
-  ssize_t bytes = ibdNinja::ReadPage(first_page_no, page_buf);
-  if (bytes != g_page_physical_size) return;
+  ssize_t bytes = space->ReadPage(first_page_no, page_buf);
+  if (bytes != space->page_physical_size()) return;
   if (PageGetType(page_buf) != FIL_PAGE_TYPE_LOB_FIRST) return;
 
   LobFirstPageHeader hdr = ReadLobFirstPageHeader(page_buf);
@@ -705,8 +917,8 @@ static void CollectLobVersions(uint32_t first_page_no,
   while (!cur_addr.is_null()) {
     if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
     if (cur_addr.page_no != cached_page_no) {
-      bytes = ibdNinja::ReadPage(cur_addr.page_no, page_buf);
-      if (bytes != g_page_physical_size) break;
+      bytes = space->ReadPage(cur_addr.page_no, page_buf);
+      if (bytes != space->page_physical_size()) break;
       cached_page_no = cur_addr.page_no;
     }
     LobIndexEntry entry = ReadLobIndexEntry(page_buf + cur_addr.byte_offset);
@@ -718,8 +930,8 @@ static void CollectLobVersions(uint32_t first_page_no,
       while (!ver_addr.is_null()) {
         if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
         if (ver_addr.page_no != ver_cached_page_no) {
-          bytes = ibdNinja::ReadPage(ver_addr.page_no, ver_buf);
-          if (bytes != g_page_physical_size) break;
+          bytes = space->ReadPage(ver_addr.page_no, ver_buf);
+          if (bytes != space->page_physical_size()) break;
           ver_cached_page_no = ver_addr.page_no;
         }
         LobIndexEntry old_entry = ReadLobIndexEntry(
@@ -745,10 +957,10 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
   unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
   memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
   unsigned char* buf = static_cast<unsigned char*>(
-                    ut_align(buf_unalign, g_page_physical_size));
+                    ut_align(buf_unalign, space_->page_physical_size()));
 
-  ssize_t bytes = ReadPage(page_no, buf);
-  if (bytes != g_page_physical_size) {
+  ssize_t bytes = space_->ReadPage(page_no, buf);
+  if (bytes != space_->page_physical_size()) {
     ninja_error("Failed to read page: %u", page_no);
     return;
   }
@@ -804,7 +1016,7 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
   printf("Inspecting page %u, record %u\n", page_no, rec_no);
 
   // Create Record object and compute offsets
-  Record rec(current_rec, index);
+  Record rec(current_rec, index, space_);
   uint32_t* offsets = rec.GetColumnOffsets();
   if (offsets == nullptr) {
     ninja_error("Failed to compute column offsets for record %u", rec_no);
@@ -885,7 +1097,7 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
          field.is_json ? " [JSON]" : "");
 
   // Step 3: Visualize the LOB chain
-  PrintLobChainVisualization(field.page_no, field.is_json);
+  PrintLobChainVisualization(space_, field.page_no, field.is_json);
 
   // Helper lambda to generate filename
   auto gen_filename = [&](uint32_t version, bool as_json) -> std::string {
@@ -950,7 +1162,7 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
   auto select_version = [&](uint32_t* target_ver) -> bool {
     std::vector<uint32_t> versions;
     uint32_t max_lob_ver = 0;
-    CollectLobVersions(field.page_no, &versions, &max_lob_ver);
+    CollectLobVersions(space_, field.page_no, &versions, &max_lob_ver);
     if (versions.empty()) {
       printf("No versions found.\n");
       return false;
@@ -1048,8 +1260,8 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
       if (fetch_len > LOB_MAX_FETCH_SIZE) fetch_len = LOB_MAX_FETCH_SIZE;
       *out_data = new unsigned char[fetch_len + 1]();
       bool error = false;
-      *out_len = FetchModernUncompLob(field.page_no, field.ext_len,
-                                      *out_data, &error);
+      *out_len = FetchModernUncompLob(space_, field.page_no, field.ext_len,
+                                      LOB_MAX_FETCH_SIZE, *out_data, &error);
       if (error) {
         printf("Error fetching LOB data.\n");
         delete[] *out_data;
@@ -1066,7 +1278,8 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
       if (fetch_len > LOB_MAX_FETCH_SIZE) fetch_len = LOB_MAX_FETCH_SIZE;
       *out_data = new unsigned char[fetch_len + 1]();
       bool error = false;
-      *out_len = FetchLobByVersion(field.page_no, ver, *out_data, &error);
+      *out_len = FetchLobByVersion(space_, field.page_no, ver, *out_data,
+                                   &error);
       if (error) {
         printf("Error fetching LOB data for version %u.\n", ver);
         delete[] *out_data;
@@ -1079,7 +1292,8 @@ void ibdNinja::InspectBlob(uint32_t page_no, uint32_t rec_no) {
     // Get current LOB version from header
     auto get_current_version = [&]() -> uint32_t {
       unsigned char tmp[UNIV_PAGE_SIZE_MAX];
-      if (ibdNinja::ReadPage(field.page_no, tmp) != g_page_physical_size) {
+      if (space_->ReadPage(field.page_no, tmp) !=
+          space_->page_physical_size()) {
         return 1;
       }
       LobFirstPageHeader hdr = ReadLobFirstPageHeader(tmp);
@@ -1223,75 +1437,16 @@ void ibdNinja::PrintName() {
 "|--------------------------------------------------------------------------------------------------------------|\n");
 }
 
-ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename) {
+ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename, bool print) {
   unsigned char buf[UNIV_PAGE_SIZE_MAX];
   memset(buf, 0, UNIV_PAGE_SIZE_MAX);
-  struct stat stat_info;
-  if (stat(ibd_filename, &stat_info) != 0) {
-    ninja_error("Failed to get file stats: %s, error: %d(%s)",
-            ibd_filename, errno, strerror(errno));
-    return nullptr;
-  }
-  uint64_t size = stat_info.st_size;
-  g_fd = open(ibd_filename, O_RDONLY);
-  if (g_fd == -1) {
-    ninja_error("Failed to open file: %s, error: %d(%s)",
-            ibd_filename, errno, strerror(errno));
-    close(g_fd);
-    return nullptr;
-  }
-  if (size < UNIV_ZIP_SIZE_MIN) {
-    ninja_error("The file is too small to be a valid ibd file");
-    close(g_fd);
-    return nullptr;
-  }
-  ssize_t bytes = read(g_fd, buf, UNIV_ZIP_SIZE_MIN);
-  if (bytes != UNIV_ZIP_SIZE_MIN) {
-    ninja_error("Failed to read file header: %s, error: %d(%s)",
-            ibd_filename, errno, strerror(errno));
-    close(g_fd);
-    return nullptr;
-  }
-  uint32_t space_id = ReadFrom4B(buf + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
-  uint32_t first_page_no = ReadFrom4B(buf + FIL_PAGE_OFFSET);
-  uint32_t flags = FSPHeaderGetFlags(buf);
-  bool is_valid_flags = FSPFlagsIsValid(flags);
-  uint32_t page_size = 0;
-  if (is_valid_flags) {
-    uint32_t ssize = FSP_FLAGS_GET_PAGE_SSIZE(flags);
-    if (ssize == 0) {
-      page_size = UNIV_PAGE_SIZE_ORIG;
-    } else {
-      page_size = ((UNIV_ZIP_SIZE_MIN >> 1) << ssize);
-    }
-    g_page_size_shift = PageSizeValidate(page_size);
-  }
-  if (!is_valid_flags || g_page_size_shift == 0) {
-    ninja_error("Found corruption on page 0 of file %s",
-            ibd_filename);
-    close(g_fd);
+  Tablespace* space = Tablespace::Open(ibd_filename, g_use_mmap);
+  if (space == nullptr) {
     return nullptr;
   }
-
-  g_page_logical_size = page_size;
-
-  assert(g_page_logical_size <= UNIV_PAGE_SIZE_MAX);
-  assert(g_page_logical_size <= (1 << PAGE_SIZE_T_SIZE_BITS));
-
-  uint32_t ssize = FSP_FLAGS_GET_ZIP_SSIZE(flags);
-
-  if (ssize == 0) {
-    g_page_compressed = false;
-    g_page_physical_size = g_page_logical_size;
-  } else {
-    g_page_compressed = true;
-
-    g_page_physical_size = ((UNIV_ZIP_SIZE_MIN >> 1) << ssize);
-
-    assert(g_page_physical_size <= UNIV_ZIP_SIZE_MAX);
-    assert(g_page_physical_size <= (1 << PAGE_SIZE_T_SIZE_BITS));
-  }
-  uint32_t n_pages = size / g_page_physical_size;
+  uint64_t size = space->file_size();
+  uint32_t flags = space->flags();
+  uint32_t n_pages = space->n_pages();
 
   uint32_t post_antelope = FSP_FLAGS_GET_POST_ANTELOPE(flags);
   uint32_t atomic_blobs = FSP_FLAGS_HAS_ATOMIC_BLOBS(flags);
@@ -1301,15 +1456,18 @@ ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename) {
   uint32_t encryption = FSP_FLAGS_GET_ENCRYPTION(flags);
   uint32_t has_sdi = FSP_FLAGS_HAS_SDI(flags);
 
-  bytes = ReadPage(0, buf);
+  ssize_t bytes = space->ReadPage(0, buf);
   if (bytes == -1) {
     ninja_error("Failed to read file header: %s, error: %d(%s)",
             ibd_filename, errno, strerror(errno));
-    close(g_fd);
+    delete space;
     return nullptr;
   }
+  uint32_t space_id = ReadFrom4B(buf + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
+  uint32_t first_page_no = ReadFrom4B(buf + FIL_PAGE_OFFSET);
   uint32_t sdi_offset = XDES_ARR_OFFSET +
-                    XDES_SIZE * (g_page_physical_size / FSP_EXTENT_SIZE) +
+                    space->xdes_size() *
+                    (space->page_physical_size() / space->extent_size()) +
                     INFO_MAX_SIZE;
   assert(sdi_offset + 4 < bytes);
   uint32_t sdi_root = ReadFrom4B(buf + sdi_offset + 4);
@@ -1318,41 +1476,47 @@ ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename) {
                "Attempting to parse the SDI root page %u directly anyway.",
                sdi_root);
   }
-  fprintf(stdout, "=========================================="
+  ninja_pt(print, "=========================================="
                   "==========================================\n");
-  fprintf(stdout, "|  FILE INFORMATION                       "
+  ninja_pt(print, "|  FILE INFORMATION                       "
                   "                                         |\n");
-  fprintf(stdout, "------------------------------------------"
+  ninja_pt(print, "------------------------------------------"
                   "------------------------------------------\n");
-  fprintf(stdout, "    File name:             %s\n", ibd_filename);
-  fprintf(stdout, "    File size:             %" PRIu64 " B\n", size);
-  fprintf(stdout, "    Space id:              %u\n", space_id);
-  fprintf(stdout, "    Page logical size:     %u B\n", g_page_logical_size);
-  fprintf(stdout, "    Page physical size:    %u B\n", g_page_physical_size);
-  fprintf(stdout, "    Total number of pages: %u\n", n_pages);
-  fprintf(stdout, "    Is compressed page?    %u\n", g_page_compressed);
-  fprintf(stdout, "    First page number:     %u\n", first_page_no);
-  fprintf(stdout, "    SDI root page number:  %u\n", sdi_root);
-  fprintf(stdout, "    Post antelop:          %u\n", post_antelope);
-  fprintf(stdout, "    Atomic blobs:          %u\n", atomic_blobs);
-  fprintf(stdout, "    Has data dir:          %u\n", has_data_dir);
-  fprintf(stdout, "    Shared:                %u\n", shared);
-  fprintf(stdout, "    Temporary:             %u\n", temporary);
-  fprintf(stdout, "    Encryption:            %u\n", encryption);
-  fprintf(stdout, "------------------------------------------"
+  ninja_pt(print, "    File name:             %s\n", ibd_filename);
+  ninja_pt(print, "    File size:             %" PRIu64 " B\n", size);
+  ninja_pt(print, "    Space id:              %u\n", space_id);
+  ninja_pt(print, "    Page logical size:     %u B\n",
+                  space->page_logical_size());
+  ninja_pt(print, "    Page physical size:    %u B\n",
+                  space->page_physical_size());
+  ninja_pt(print, "    Total number of pages: %u\n", n_pages);
+  ninja_pt(print, "    Is compressed page?    %u\n",
+                  space->page_compressed());
+  ninja_pt(print, "    First page number:     %u\n", first_page_no);
+  ninja_pt(print, "    SDI root page number:  %u\n", sdi_root);
+  ninja_pt(print, "    Post antelop:          %u\n", post_antelope);
+  ninja_pt(print, "    Atomic blobs:          %u\n", atomic_blobs);
+  ninja_pt(print, "    Has data dir:          %u\n", has_data_dir);
+  ninja_pt(print, "    Shared:                %u\n", shared);
+  ninja_pt(print, "    Temporary:             %u\n", temporary);
+  ninja_pt(print, "    Encryption:            %u\n", encryption);
+  ninja_pt(print, "------------------------------------------"
                   "------------------------------------------\n");
 
-  if (g_page_compressed) {
+  if (space->page_compressed()) {
     ninja_error("Parsing of compressed table/tablespaces is "
                 "not yet supported.");
+    delete space;
     return nullptr;
   }
   if (encryption) {
     ninja_error("Parsing of encrpted space is not yet supported");
+    delete space;
     return nullptr;
   }
   if (temporary) {
     ninja_error("Parsing of temporary space is not yet supported");
+    delete space;
     return nullptr;
   }
 
@@ -1364,29 +1528,32 @@ ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename) {
   unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
   memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
   unsigned char* buf_align = static_cast<unsigned char*>(
-                    ut_align(buf_unalign, g_page_physical_size));
+                    ut_align(buf_unalign, space->page_physical_size()));
   uint32_t leaf_page_no = 0;
-  bool res = SDIToLeftmostLeaf(buf_align, sdi_root, &leaf_page_no);
+  bool res = SDIToLeftmostLeaf(space, buf_align, sdi_root, &leaf_page_no);
   if (!res) {
+    delete space;
     return nullptr;
   }
 
   /* DEBUG
   fprintf(stdout, "            2. Parsing SDI records and loading tables:\n");
   */
-  unsigned char* current_rec = SDIGetFirstUserRec(buf_align,
-                                                  g_page_physical_size);
+  unsigned char* current_rec = SDIGetFirstUserRec(space, buf_align,
+                                                  space->page_physical_size());
   if (current_rec == nullptr) {
+    delete space;
     return nullptr;
   }
-  ibdNinja* ninja = new ibdNinja(n_pages);
+  ibdNinja* ninja = new ibdNinja(space);
   bool corrupt = false;
   uint64_t sdi_id = 0;
   uint64_t sdi_type = 0;
   unsigned char* sdi_data = nullptr;
   uint64_t sdi_data_len = 0;
   while (current_rec != nullptr && !corrupt) {
-    bool ret = SDIParseRec(current_rec, &sdi_type, &sdi_id, &sdi_data, &sdi_data_len);
+    bool ret = SDIParseRec(space, current_rec, &sdi_type, &sdi_id,
+                           &sdi_data, &sdi_data_len);
     if (ret == false) {
       corrupt = true;
       break;
@@ -1440,17 +1607,17 @@ ibdNinja* ibdNinja::CreateNinja(const char* ibd_filename) {
       delete[] sdi_data;
     }
 
-    current_rec = SDIGetNextRec(current_rec, buf_align,
-                            g_page_physical_size, &corrupt);
+    current_rec = SDIGetNextRec(space, current_rec, buf_align,
+                                space->page_physical_size(), &corrupt);
   }
   if (corrupt) {
     delete ninja;
     return nullptr;
   }
-  fprintf(stdout, "[ibdNinja]: Successfully loaded %5lu tables "
+  ninja_pt(print, "[ibdNinja]: Successfully loaded %5lu tables "
                   "with %5lu indexes.\n",
           ninja->tables()->size(), ninja->indexes()->size());
-  fprintf(stdout, "=========================================="
+  ninja_pt(print, "=========================================="
                   "==========================================\n\n");
   return ninja;
 }
@@ -1480,10 +1647,11 @@ void ibdNinja::AddTable(Table* table) {
   }
 }
 
-bool ibdNinja::SDIToLeftmostLeaf(unsigned char* buf, uint32_t sdi_root,
+bool ibdNinja::SDIToLeftmostLeaf(Tablespace* space,
+                                 unsigned char* buf, uint32_t sdi_root,
                                  uint32_t* leaf_page_no) {
-  uint32_t bytes = ReadPage(sdi_root, buf);
-  if (bytes != g_page_physical_size) {
+  uint32_t bytes = space->ReadPage(sdi_root, buf);
+  if (bytes != space->page_physical_size()) {
     ninja_error("Failed to read page: %u, error: %d(%s)",
             sdi_root, errno, strerror(errno));
     return false;
@@ -1528,8 +1696,8 @@ bool ibdNinja::SDIToLeftmostLeaf(unsigned char* buf, uint32_t sdi_root,
 
     uint64_t curr_page_level = page_level;
 
-    bytes = ReadPage(child_page_no, buf);
-    if (bytes != g_page_physical_size) {
+    bytes = space->ReadPage(child_page_no, buf);
+    if (bytes != space->page_physical_size()) {
       ninja_error("Failed to read page: %u, error: %d(%s)",
               child_page_no, errno, strerror(errno));
       return false;
@@ -1557,7 +1725,8 @@ bool ibdNinja::SDIToLeftmostLeaf(unsigned char* buf, uint32_t sdi_root,
   return true;
 }
 
-unsigned char* ibdNinja::SDIGetFirstUserRec(unsigned char* buf,
+unsigned char* ibdNinja::SDIGetFirstUserRec(Tablespace* space,
+                                            unsigned char* buf,
                                             uint32_t buf_len) {
   uint32_t next_rec_off_t =
             ReadFrom2B(buf + PAGE_NEW_INFIMUM - REC_OFF_NEXT);
@@ -1586,7 +1755,7 @@ unsigned char* ibdNinja::SDIGetFirstUserRec(unsigned char* buf,
   if (RecGetDeletedFlag(current_rec, is_comp) != 0) {
     bool corrupt;
     current_rec =
-        SDIGetNextRec(current_rec, buf, buf_len, &corrupt);
+        SDIGetNextRec(space, current_rec, buf, buf_len, &corrupt);
     if (corrupt) {
       return nullptr;
     }
@@ -1595,14 +1764,16 @@ unsigned char* ibdNinja::SDIGetFirstUserRec(unsigned char* buf,
   return current_rec;
 }
 
-unsigned char* ibdNinja::SDIGetNextRec(unsigned char* current_rec,
+unsigned char* ibdNinja::SDIGetNextRec(Tablespace* space,
+                                       unsigned char* current_rec,
                                        unsigned char* buf,
                                        uint32_t buf_len,
                                        bool* corrupt) {
   *corrupt = false;
   uint32_t page_no = ReadFrom4B(buf + FIL_PAGE_OFFSET);
   bool is_comp = PageIsCompact(buf);
-  uint32_t next_rec_offset = RecGetNextOffs(current_rec, is_comp);
+  uint32_t next_rec_offset = RecGetNextOffs(current_rec, is_comp,
+                                            space->page_logical_size());
 
   if (next_rec_offset == 0) {
     ninja_error("Record is corrupt");
@@ -1616,7 +1787,7 @@ unsigned char* ibdNinja::SDIGetNextRec(unsigned char* current_rec,
 
   if (RecGetDeletedFlag(next_rec, is_comp) != 0) {
     unsigned char* curr_rec = next_rec;
-    return SDIGetNextRec(curr_rec, buf, buf_len, corrupt);
+    return SDIGetNextRec(space, curr_rec, buf, buf_len, corrupt);
   }
 
   if (RecGetType(next_rec) == REC_STATUS_SUPREMUM) {
@@ -1641,8 +1812,8 @@ unsigned char* ibdNinja::SDIGetNextRec(unsigned char* current_rec,
       return nullptr;
     }
 
-    uint32_t bytes = ReadPage(next_page_no, buf);
-    if (bytes != g_page_physical_size) {
+    uint32_t bytes = space->ReadPage(next_page_no, buf);
+    if (bytes != space->page_physical_size()) {
       ninja_error("Failed to read page: %u, error: %d(%s)",
               next_page_no, errno, strerror(errno));
       *corrupt = true;
@@ -1658,7 +1829,7 @@ unsigned char* ibdNinja::SDIGetNextRec(unsigned char* current_rec,
       return nullptr;
     }
 
-    next_rec = SDIGetFirstUserRec(buf, buf_len);
+    next_rec = SDIGetFirstUserRec(space, buf, buf_len);
   }
 
   *corrupt = false;
@@ -1666,10 +1837,11 @@ unsigned char* ibdNinja::SDIGetNextRec(unsigned char* current_rec,
   return next_rec;
 }
 
-bool ibdNinja::SDIParseRec(unsigned char* rec,
+bool ibdNinja::SDIParseRec(Tablespace* space, unsigned char* rec,
                         uint64_t* sdi_type, uint64_t* sdi_id,
                         unsigned char** sdi_data, uint64_t* sdi_data_len) {
-  if (RecIsInfimum(rec) || RecIsSupremum(rec)) {
+  if (RecIsInfimum(rec, space->page_logical_size()) ||
+      RecIsSupremum(rec, space->page_logical_size())) {
     return false;
   }
 
@@ -1719,12 +1891,12 @@ bool ibdNinja::SDIParseRec(unsigned char* rec,
                          BTR_EXTERN_PAGE_NO);
 
     uint64_t blob_len_retrieved = 0;
-    if (g_page_compressed) {
+    if (space->page_compressed()) {
       // TODO(Zhao): Support compressed page
     } else {
       uint32_t n_ext_pages = 0;
       bool error = false;
-      blob_len_retrieved = SDIFetchUncompBlob(
+      blob_len_retrieved = SDIFetchUncompBlob(space,
           first_blob_page_no, rec_data_length - rec_data_in_page_len,
           str + rec_data_in_page_len, &n_ext_pages, &error);
     }
@@ -1765,7 +1937,8 @@ bool ibdNinja::SDIParseRec(unsigned char* rec,
   return true;
 }
 
-uint64_t ibdNinja::SDIFetchUncompBlob(uint32_t first_blob_page_no,
+uint64_t ibdNinja::SDIFetchUncompBlob(Tablespace* space,
+                                      uint32_t first_blob_page_no,
                                       uint64_t total_off_page_length,
                                       unsigned char* dest_buf,
                                       uint32_t* n_ext_pages,
@@ -1778,9 +1951,9 @@ uint64_t ibdNinja::SDIFetchUncompBlob(uint32_t first_blob_page_no,
   *n_ext_pages = 0;
 
   do {
-    uint32_t bytes = ReadPage(next_page_no, page_buf);
+    uint32_t bytes = space->ReadPage(next_page_no, page_buf);
     *n_ext_pages += 1;
-    if (bytes != g_page_physical_size) {
+    if (bytes != space->page_physical_size()) {
       ninja_error("Failed to read BLOB page: %u, error: %d(%s)",
               next_page_no, errno, strerror(errno));
       *error = true;
@@ -1826,7 +1999,7 @@ unsigned char* ibdNinja::GetFirstUserRec(unsigned char* buf) {
 
   assert(PAGE_NEW_INFIMUM + next_rec_off_t != PAGE_NEW_SUPREMUM);
 
-  if (next_rec_off_t > g_page_physical_size) {
+  if (next_rec_off_t > space_->page_physical_size()) {
     assert(0);
     return (nullptr);
   }
@@ -1838,7 +2011,8 @@ unsigned char* ibdNinja::GetFirstUserRec(unsigned char* buf) {
 
   unsigned char* current_rec = buf + PAGE_NEW_INFIMUM + next_rec_off_t;
 
-  assert(static_cast<uint32_t>(current_rec - buf) <= g_page_physical_size);
+  assert(static_cast<uint32_t>(current_rec - buf) <=
+         space_->page_physical_size());
 
   bool is_comp = PageIsCompact(buf);
 
@@ -1854,7 +2028,8 @@ unsigned char* ibdNinja::GetNextRecInPage(unsigned char* current_rec,
   *corrupt = false;
   uint32_t page_no = ReadFrom4B(buf + FIL_PAGE_OFFSET);
   bool is_comp = PageIsCompact(buf);
-  uint32_t next_rec_offset = RecGetNextOffs(current_rec, is_comp);
+  uint32_t next_rec_offset = RecGetNextOffs(current_rec, is_comp,
+                                            space_->page_logical_size());
 
   if (next_rec_offset == 0) {
     ninja_error("Record is corrupt");
@@ -1865,7 +2040,7 @@ unsigned char* ibdNinja::GetNextRecInPage(unsigned char* current_rec,
 
   unsigned char* next_rec = buf + next_rec_offset;
 
-  assert(static_cast<uint32_t>(next_rec - buf) <= g_page_physical_size);
+  assert(static_cast<uint32_t>(next_rec - buf) <= space_->page_physical_size());
 
   if (RecGetType(next_rec) == REC_STATUS_SUPREMUM) {
     if (memcmp(next_rec, "supremum", strlen("supremum")) != 0) {
@@ -1887,16 +2062,6 @@ unsigned char* ibdNinja::GetNextRecInPage(unsigned char* current_rec,
   return next_rec;
 }
 
-ssize_t ibdNinja::ReadPage(uint32_t page_no, unsigned char* buf) {
-  assert(buf != nullptr);
-  memset(buf, 0, g_page_physical_size);
-  off_t offset = page_no * g_page_physical_size;
-  ssize_t n_bytes_read = pread(g_fd, buf, g_page_physical_size, offset);
-
-  // TODO(Zhao): Support compressed page
-  return n_bytes_read;
-}
-
 bool ibdNinja::ParsePage(uint32_t page_no,
                          PageAnalysisResult* result_aggr,
                          bool print,
@@ -1909,16 +2074,31 @@ bool ibdNinja::ParsePage(uint32_t page_no,
   unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
   memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
   unsigned char* buf = static_cast<unsigned char*>(
-                    ut_align(buf_unalign, g_page_physical_size));
-  ssize_t bytes = ReadPage(page_no, buf);
-  if (bytes != g_page_physical_size) {
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  unsigned char* page = space_->GetPage(page_no, buf);
+  if (page == nullptr) {
     ninja_error("Failed to read page: %u, error: %d(%s)",
             page_no, errno, strerror(errno));
     return false;
   }
+  OutputWriter* writer = nullptr;
+  if (print) {
+    writer = OutputWriter::Create(g_output_format, stdout);
+  }
+  bool ret = ParsePage(page_no, page, result_aggr, print && writer == nullptr,
+                       print_record, writer);
+  delete writer;
+  return ret;
+}
+
+bool ibdNinja::ParsePage(uint32_t page_no, unsigned char* buf,
+                         PageAnalysisResult* result_aggr,
+                         bool print,
+                         bool print_record,
+                         OutputWriter* writer) {
   if (memcmp(
           buf + FIL_PAGE_LSN + 4,
-          buf + g_page_logical_size - FIL_PAGE_END_LSN_OLD_CHKSUM + 4,
+          buf + space_->page_logical_size() - FIL_PAGE_END_LSN_OLD_CHKSUM + 4,
           4)) {
     ninja_error("The LSN on page %u is inconsistent", page_no);
     return false;
@@ -1930,6 +2110,11 @@ bool ibdNinja::ParsePage(uint32_t page_no,
   if (type == FIL_PAGE_TYPE_LOB_FIRST ||
       type == FIL_PAGE_TYPE_LOB_DATA ||
       type == FIL_PAGE_TYPE_LOB_INDEX) {
+    if (writer != nullptr) {
+      writer->BeginPage(page_no, type, 0, 0, 0, nullptr);
+      writer->EndPage(nullptr);
+      return true;
+    }
     uint32_t page_no_in_fil = ReadFrom4B(buf + FIL_PAGE_OFFSET);
     uint32_t space_id = ReadFrom4B(buf + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID);
     ninja_pt(print, "=========================================="
@@ -1999,8 +2184,8 @@ bool ibdNinja::ParsePage(uint32_t page_no,
                entry_idx < hdr.index_list.length) {
           if (++pages_visited > LOB_MAX_PAGES_VISITED) break;
           if (cur_addr.page_no != cached_page) {
-            ssize_t b = ReadPage(cur_addr.page_no, idx_buf);
-            if (b != g_page_physical_size) break;
+            ssize_t b = space_->ReadPage(cur_addr.page_no, idx_buf);
+            if (b != space_->page_physical_size()) break;
             cached_page = cur_addr.page_no;
           }
           LobIndexEntry entry = ReadLobIndexEntry(
@@ -2024,7 +2209,7 @@ bool ibdNinja::ParsePage(uint32_t page_no,
       uint32_t first_page_data_offset = FIL_PAGE_DATA +
           LOB_FIRST_PAGE_INDEX_BEGIN +
           LOB_FIRST_PAGE_N_ENTRIES * LOB_INDEX_ENTRY_SIZE;
-      uint32_t avail_data = g_page_logical_size - FIL_PAGE_DATA_END -
+      uint32_t avail_data = space_->page_logical_size() - FIL_PAGE_DATA_END -
                             first_page_data_offset;
       ninja_pt(print, "\n    First page data capacity: %u bytes\n",
                avail_data);
@@ -2120,8 +2305,8 @@ bool ibdNinja::ParsePage(uint32_t page_no,
   ninja_pt(print, "    -------------------\n");
   ninja_pt(print, "    Page level:        %u\n", page_level);
   ninja_pt(print, "    Page size:         [logical: %u B], [physical: %u B]\n",
-                       g_page_logical_size,
-                       g_page_physical_size);
+                       space_->page_logical_size(),
+                       space_->page_physical_size());
   ninja_pt(print, "    Number of records: %u\n", n_recs);
   ninja_pt(print, "    Index id:          %" PRIu64 "\n", index_id);
   if (!index_not_found) {
@@ -2144,13 +2329,14 @@ bool ibdNinja::ParsePage(uint32_t page_no,
 
   ninja_pt(print, "\n");
 
-  if (index_not_found) {
-    ninja_warn("Skipping record parsing");
-    return false;
+  if (writer != nullptr) {
+    writer->BeginPage(page_no, type, page_level, n_recs, index_id, index);
   }
-
-  if (!index->IsIndexParsingRecSupported()) {
+  if (index_not_found || !index->IsIndexParsingRecSupported()) {
     ninja_warn("Skipping record parsing");
+    if (writer != nullptr) {
+      writer->EndPage(nullptr);
+    }
     return false;
   }
 
@@ -2169,10 +2355,10 @@ bool ibdNinja::ParsePage(uint32_t page_no,
     bool corrupt = false;
     while (current_rec != nullptr && corrupt != true) {
       i++;
-      Record rec(current_rec, index);
+      Record rec(current_rec, index, space_);
       rec.GetColumnOffsets();
       rec.ParseRecord(page_level == 0, i, &result,
-                      print_rec);
+                      print_rec, print_record ? writer : nullptr);
       current_rec = GetNextRecInPage(current_rec, buf, &corrupt);
     }
     if (corrupt != true) {
@@ -2190,13 +2376,13 @@ bool ibdNinja::ParsePage(uint32_t page_no,
   ninja_pt(print, "------------------------------------------"
       "------------------------------------------\n");
   if (page_level == 0) {
-    ninja_pt(print, "Total valid records count:                %u\n",
+    ninja_pt(print, "Total valid records count:                %" PRIu64 "\n",
         result.n_recs_leaf);
-    ninja_pt(print, "Total valid records size:                 %u B\n"
+    ninja_pt(print, "Total valid records size:                 %" PRIu64 " B\n"
         "                                            "
-        "[Headers: %u B]\n"
+        "[Headers: %" PRIu64 " B]\n"
         "                                            "
-        "[Bodies:  %u B]\n",
+        "[Bodies:  %" PRIu64 " B]\n",
         result.headers_len_leaf + result.recs_len_leaf,
         result.headers_len_leaf, result.recs_len_leaf);
     ninja_pt(print, "Valid records to page space ratio:        "
@@ -2204,35 +2390,35 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         static_cast<double>(
           (result.headers_len_leaf +
            result.recs_len_leaf)) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     ninja_pt(print, "\n");
-    ninja_pt(print, "Total records with dropped columns count: %u\n",
+    ninja_pt(print, "Total records with dropped columns count: %" PRIu64 "\n",
         result.n_contain_dropped_cols_recs_leaf);
-    ninja_pt(print, "Total instant dropped columns size:       %u B\n",
+    ninja_pt(print, "Total instant dropped columns size:       %" PRIu64 " B\n",
         result.dropped_cols_len_leaf);
     ninja_pt(print, "Dropped columns to page space ratio:      "
         "%02.05lf %%\n",
         static_cast<double>(
           result.dropped_cols_len_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     ninja_pt(print, "\n");
-    ninja_pt(print, "Total delete-marked records count:        %u\n",
+    ninja_pt(print, "Total delete-marked records count:        %" PRIu64 "\n",
         result.n_deleted_recs_leaf);
-    ninja_pt(print, "Total delete-marked records size:         %u B\n",
+    ninja_pt(print, "Total delete-marked records size:         %" PRIu64 " B\n",
         result.deleted_recs_len_leaf);
     ninja_pt(print, "Delete-marked recs to page space ratio:   "
         "%02.05lf %%\n",
         static_cast<double>(
           result.deleted_recs_len_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     result.innodb_internal_used_leaf =
       PAGE_NEW_SUPREMUM_END + result.headers_len_leaf +
       n_dir_slots * PAGE_DIR_SLOT_SIZE  + FIL_PAGE_DATA_END;
     ninja_pt(print, "\n");
-    ninja_pt(print, "Total InnoDB internal space used:         %u B\n"
+    ninja_pt(print, "Total InnoDB internal space used:         %" PRIu64 " B\n"
         "                                            "
         "[FIL HEADER     38 B]\n"
         "                                            "
@@ -2242,7 +2428,7 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         "                                            "
         "[INFI + SUPRE   26 B]\n"
         "                                            "
-        "[RECORD HEADERS %u B]*\n"
+        "[RECORD HEADERS %" PRIu64 " B]*\n"
         "                                            "
         "[PAGE DIRECTORY %u B]\n"
         "                                            "
@@ -2254,26 +2440,37 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         "%02.05lf %%\n",
         static_cast<double>(
           result.innodb_internal_used_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     ninja_pt(print, "\n");
-    result.free_leaf = garbage + UNIV_PAGE_SIZE - PAGE_DIR -
+    result.free_leaf = garbage + space_->page_logical_size() - PAGE_DIR -
       n_dir_slots * PAGE_DIR_SLOT_SIZE - heap_top;
-    ninja_pt(print, "Total free space:                         %u B\n",
+    ninja_pt(print, "Total free space:                         %" PRIu64 " B\n",
         result.free_leaf);
     ninja_pt(print, "Free space ratio:                         "
         "%02.05lf %%\n",
         static_cast<double>(
           result.free_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
+
+    if (g_lob_stats) {
+      ninja_pt(print, "\n");
+      ninja_pt(print, "Total external fields count:              %" PRIu64 "\n",
+          result.n_lob_fields);
+      ninja_pt(print, "Total external pages count:               %" PRIu64 "\n",
+          result.n_lob_pages);
+      ninja_pt(print, "Total external data size:                 "
+          "%" PRIu64 " B\n",
+          result.lob_data_len);
+    }
   } else {
-    ninja_pt(print, "Total valid records count:               %u\n",
+    ninja_pt(print, "Total valid records count:               %" PRIu64 "\n",
         result.n_recs_non_leaf);
-    ninja_pt(print, "Total valid records size:                %u B\n"
+    ninja_pt(print, "Total valid records size:                %" PRIu64 " B\n"
         "                                           "
-        "[Headers: %u B]\n"
+        "[Headers: %" PRIu64 " B]\n"
         "                                           "
-        "[Bodies : %u B)\n",
+        "[Bodies : %" PRIu64 " B)\n",
         result.headers_len_non_leaf + result.recs_len_non_leaf,
         result.headers_len_non_leaf, result.recs_len_non_leaf);
     ninja_pt(print, "Valid records to page space ratio:       "
@@ -2281,18 +2478,18 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         static_cast<double>(
           (result.headers_len_non_leaf +
            result.recs_len_non_leaf)) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     ninja_pt(print, "\n");
-    ninja_pt(print, "Total delete-marked records count:       %u\n",
+    ninja_pt(print, "Total delete-marked records count:       %" PRIu64 "\n",
         result.n_deleted_recs_non_leaf);
-    ninja_pt(print, "Total delete-marked records size:        %u B\n",
+    ninja_pt(print, "Total delete-marked records size:        %" PRIu64 " B\n",
         result.deleted_recs_len_non_leaf);
     ninja_pt(print, "Delete-marked recs to page space ratio:  "
         "%02.05lf %%\n",
         static_cast<double>(
           result.deleted_recs_len_non_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     assert(result.n_contain_dropped_cols_recs_non_leaf == 0);
     assert(result.dropped_cols_len_non_leaf == 0);
@@ -2301,7 +2498,7 @@ bool ibdNinja::ParsePage(uint32_t page_no,
       PAGE_NEW_SUPREMUM_END + result.headers_len_non_leaf +
       n_dir_slots * PAGE_DIR_SLOT_SIZE  + FIL_PAGE_DATA_END;
     ninja_pt(print, "\n");
-    ninja_pt(print, "Total innoDB internal space used:        %u B\n"
+    ninja_pt(print, "Total innoDB internal space used:        %" PRIu64 " B\n"
         "                                           "
         "[FIL HEADER     38 B]\n"
         "                                           "
@@ -2311,7 +2508,7 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         "                                           "
         "[INFI + SUPRE   26 B]\n"
         "                                           "
-        "[RECORD HEADERS %u B]*\n"
+        "[RECORD HEADERS %" PRIu64 " B]*\n"
         "                                           "
         "[PAGE DIRECTORY %u B]\n"
         "                                           "
@@ -2323,57 +2520,25 @@ bool ibdNinja::ParsePage(uint32_t page_no,
         "%02.05lf %%\n",
         static_cast<double>(
           result.innodb_internal_used_non_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
 
     ninja_pt(print, "\n");
-    result.free_non_leaf = garbage + UNIV_PAGE_SIZE - PAGE_DIR -
+    result.free_non_leaf = garbage + space_->page_logical_size() - PAGE_DIR -
       n_dir_slots * PAGE_DIR_SLOT_SIZE - heap_top;
-    ninja_pt(print, "Total free space:                        %u B\n",
+    ninja_pt(print, "Total free space:                        %" PRIu64 " B\n",
         result.free_non_leaf);
     ninja_pt(print, "Free space ratio:                        "
         "%02.05lf %%\n",
         static_cast<double>(
           result.free_non_leaf) /
-        g_page_physical_size * 100);
+        space_->page_physical_size() * 100);
+  }
+  if (writer != nullptr) {
+    writer->EndPage(&result);
   }
   // aggregate the page result to the index result
   if (result_aggr != nullptr) {
-    result_aggr->n_recs_non_leaf +=
-      result.n_recs_non_leaf;
-    result_aggr->n_recs_leaf +=
-      result.n_recs_leaf;
-    result_aggr->headers_len_non_leaf +=
-      result.headers_len_non_leaf;
-    result_aggr->headers_len_leaf +=
-      result.headers_len_leaf;
-    result_aggr->recs_len_non_leaf +=
-      result.recs_len_non_leaf;
-    result_aggr->recs_len_leaf +=
-      result.recs_len_leaf;
-    result_aggr->n_deleted_recs_non_leaf +=
-      result.n_deleted_recs_non_leaf;
-    result_aggr->n_deleted_recs_leaf +=
-      result.n_deleted_recs_leaf;
-    result_aggr->deleted_recs_len_non_leaf +=
-      result.deleted_recs_len_non_leaf;
-    result_aggr->deleted_recs_len_leaf +=
-      result.deleted_recs_len_leaf;
-    result_aggr->n_contain_dropped_cols_recs_non_leaf +=
-      result.n_contain_dropped_cols_recs_non_leaf;
-    result_aggr->n_contain_dropped_cols_recs_leaf +=
-      result.n_contain_dropped_cols_recs_leaf;
-    result_aggr->dropped_cols_len_non_leaf +=
-      result.dropped_cols_len_non_leaf;
-    result_aggr->dropped_cols_len_leaf +=
-      result.dropped_cols_len_leaf;
-    result_aggr->innodb_internal_used_non_leaf +=
-      result.innodb_internal_used_non_leaf;
-    result_aggr->innodb_internal_used_leaf +=
-      result.innodb_internal_used_leaf;
-    result_aggr->free_non_leaf +=
-      result.free_non_leaf;
-    result_aggr->free_leaf +=
-      result.free_leaf;
+    result_aggr->Merge(result);
   }
 
   return true;
@@ -2386,8 +2551,8 @@ bool ibdNinja::ToLeftmostLeaf(Index* index,
     // ninja_warn("Skip getting leftmost pages");
     return false;
   }
-  uint32_t bytes = ReadPage(root, buf);
-  if (bytes != g_page_physical_size) {
+  uint32_t bytes = space_->ReadPage(root, buf);
+  if (bytes != space_->page_physical_size()) {
     ninja_error("Failed to read page: %u, error: %d(%s)",
             root, errno, strerror(errno));
     return false;
@@ -2404,14 +2569,14 @@ bool ibdNinja::ToLeftmostLeaf(Index* index,
     if (current_rec == nullptr) {
       break;
     }
-    Record record(current_rec, index);
+    Record record(current_rec, index, space_);
     record.GetColumnOffsets();
     uint32_t child_page_no = record.GetChildPageNo();
 
     uint64_t curr_page_level = page_level;
 
-    bytes = ReadPage(child_page_no, buf);
-    if (bytes != g_page_physical_size) {
+    bytes = space_->ReadPage(child_page_no, buf);
+    if (bytes != space_->page_physical_size()) {
       ninja_error("Failed to read page: %u, error: %d(%s)",
               child_page_no, errno, strerror(errno));
       return false;
@@ -2439,58 +2604,599 @@ bool ibdNinja::ParseIndex(uint32_t index_id) {
                 "No index with ID %u was found", index_id);
     return false;
   }
-  return ParseIndex(iter->second);
+  OutputWriter* writer = OutputWriter::Create(g_output_format, stdout);
+  bool ret = ParseIndex(iter->second, writer);
+  delete writer;
+  return ret;
+}
+
+bool ibdNinja::AnalyzePage(uint32_t page_no, unsigned char* buf,
+                           PageAnalysisResult* result) {
+  if (g_fast_stats) {
+    return ParsePageHeader(page_no, buf, result);
+  }
+  return ParsePage(page_no, buf, result, false, true);
+}
+
+bool ibdNinja::ParsePageHeader(uint32_t page_no, unsigned char* buf,
+                               PageAnalysisResult* result) {
+  uint32_t page_size = space_->page_logical_size();
+  if (memcmp(buf + FIL_PAGE_LSN + 4,
+             buf + page_size - FIL_PAGE_END_LSN_OLD_CHKSUM + 4, 4)) {
+    ninja_error("The LSN on page %u is inconsistent", page_no);
+    return false;
+  }
+  uint32_t type = ReadFrom2B(buf + FIL_PAGE_TYPE);
+  if (type != FIL_PAGE_INDEX) {
+    ninja_error("Page %u is a %s page instead of an INDEX page",
+                page_no, PageType2String(type).c_str());
+    return false;
+  }
+  uint64_t index_id = ReadFrom8B(buf + PAGE_HEADER + PAGE_INDEX_ID);
+  Index* index = GetIndex(index_id);
+  if (index == nullptr) {
+    ninja_error("Unable find index %" PRIu64 " in the loaded indexes",
+            index_id);
+    return false;
+  }
+  if (!index->IsIndexParsingRecSupported()) {
+    ninja_warn("Skipping record parsing");
+    return false;
+  }
+
+  uint32_t n_dir_slots = ReadFrom2B(buf + PAGE_HEADER + PAGE_N_DIR_SLOTS);
+  uint32_t heap_top = ReadFrom2B(buf + PAGE_HEADER + PAGE_HEAP_TOP);
+  uint32_t garbage = ReadFrom2B(buf + PAGE_HEADER + PAGE_GARBAGE);
+  uint32_t n_recs = ReadFrom2B(buf + PAGE_HEADER + PAGE_N_RECS);
+  uint32_t page_level = ReadFrom2B(buf + PAGE_HEADER + PAGE_LEVEL);
+  uint32_t dir_len = n_dir_slots * PAGE_DIR_SLOT_SIZE;
+  if (heap_top < PAGE_NEW_SUPREMUM_END + garbage ||
+      heap_top + dir_len > page_size - PAGE_DIR) {
+    ninja_error("The page header of page %u is corrupt", page_no);
+    return false;
+  }
+
+  // The records, delete-marked or not, and the garbage fill the heap
+  // between the supremum and the heap top
+  bool leaf = (page_level == 0);
+  uint64_t recs_len = heap_top - PAGE_NEW_SUPREMUM_END - garbage;
+  uint64_t headers_len = std::min<uint64_t>(
+      static_cast<uint64_t>(n_recs) * index->EstimateRecHeaderLen(leaf),
+      recs_len);
+  uint64_t internal_used = PAGE_NEW_SUPREMUM_END + headers_len + dir_len +
+                           FIL_PAGE_DATA_END;
+  uint64_t free_len = garbage + page_size - PAGE_DIR - dir_len - heap_top;
+  if (leaf) {
+    result->n_recs_leaf += n_recs;
+    result->headers_len_leaf += headers_len;
+    result->recs_len_leaf += recs_len - headers_len;
+    result->innodb_internal_used_leaf += internal_used;
+    result->free_leaf += free_len;
+  } else {
+    result->n_recs_non_leaf += n_recs;
+    result->headers_len_non_leaf += headers_len;
+    result->recs_len_non_leaf += recs_len - headers_len;
+    result->innodb_internal_used_non_leaf += internal_used;
+    result->free_non_leaf += free_len;
+  }
+  return true;
+}
+
+bool ibdNinja::CollectChildPages(Index* index, unsigned char* buf,
+                                 std::vector<uint32_t>* child_pages_no) {
+  uint32_t n_recs = ReadFrom2B(buf + PAGE_HEADER + PAGE_N_RECS);
+  if (n_recs == 0) {
+    return true;
+  }
+  unsigned char* current_rec = GetFirstUserRec(buf);
+  bool corrupt = false;
+  while (current_rec != nullptr && corrupt != true) {
+    Record rec(current_rec, index, space_);
+    rec.GetColumnOffsets();
+    child_pages_no->push_back(rec.GetChildPageNo());
+    current_rec = GetNextRecInPage(current_rec, buf, &corrupt);
+  }
+  return !corrupt;
+}
+
+// Hint the pages_no[begin, end) about to be parsed, merging runs of
+// consecutive page numbers into one madvise call
+static void AdvisePageList(Tablespace* space,
+                           const std::vector<uint32_t>& pages_no,
+                           size_t begin, size_t end) {
+  size_t run_start = begin;
+  for (size_t i = begin + 1; i <= end; i++) {
+    if (i == end || pages_no[i] != pages_no[i - 1] + 1) {
+      space->AdvisePages(pages_no[run_start], i - run_start, MADV_WILLNEED);
+      run_start = i;
+    }
+  }
+}
+
+bool ibdNinja::ParseLevelParallel(uint32_t level,
+                                  const std::vector<uint32_t>& pages_no,
+                                  IndexAnalyzeResult* index_result) {
+  // The pages are split into contiguous chunks which are handed out to the
+  // workers in page order. Every chunk has its own result, and the results
+  // are merged in chunk order afterwards, so the report is identical to the
+  // one produced by walking the level serially.
+  static const size_t kPagesPerChunk = 64;
+  struct Chunk {
+    size_t begin = 0;
+    size_t end = 0;
+    IndexAnalyzeResult result;
+    uint64_t n_pages_read = 0;
+    bool read_failed = false;
+    bool parse_failed = false;
+    uint32_t failed_page_no = FIL_NULL;
+    int failed_errno = 0;
+  };
+  std::vector<Chunk> chunks((pages_no.size() + kPagesPerChunk - 1) /
+                            kPagesPerChunk);
+  for (size_t i = 0; i < chunks.size(); i++) {
+    chunks[i].begin = i * kPagesPerChunk;
+    chunks[i].end = std::min(pages_no.size(), (i + 1) * kPagesPerChunk);
+  }
+
+  std::atomic<size_t> next_chunk(0);
+  // Chunks after the first failed one are never merged, skip them
+  std::atomic<size_t> first_failed_chunk(chunks.size());
+  auto worker = [&]() {
+    unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+    memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+    unsigned char* buf = static_cast<unsigned char*>(
+                      ut_align(buf_unalign, space_->page_physical_size()));
+    size_t c = 0;
+    while ((c = next_chunk.fetch_add(1)) < chunks.size()) {
+      if (c > first_failed_chunk.load()) {
+        continue;
+      }
+      Chunk& chunk = chunks[c];
+      uint64_t n_pages_read_start = Tablespace::n_pages_read_by_thread();
+      AdvisePageList(space_, pages_no, chunk.begin, chunk.end);
+      for (size_t i = chunk.begin; i < chunk.end; i++) {
+        uint32_t page_no = pages_no[i];
+        unsigned char* page = space_->GetPage(page_no, buf);
+        if (page == nullptr) {
+          chunk.read_failed = true;
+          chunk.failed_errno = errno;
+        } else {
+          uint32_t page_level = ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL);
+          PageAnalysisResult page_result;
+          if (!AnalyzePage(page_no, page, &page_result)) {
+            chunk.parse_failed = true;
+          }
+          chunk.result.AddPage(page_level,
+                               chunk.parse_failed ? nullptr : &page_result);
+        }
+        if (chunk.read_failed || chunk.parse_failed) {
+          chunk.failed_page_no = page_no;
+          size_t failed = first_failed_chunk.load();
+          while (c < failed &&
+                 !first_failed_chunk.compare_exchange_weak(failed, c)) {
+          }
+          break;
+        }
+      }
+      chunk.n_pages_read = Tablespace::n_pages_read_by_thread() -
+                           n_pages_read_start;
+    }
+  };
+
+  size_t n_workers = std::min<size_t>(n_threads_, chunks.size());
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < n_workers; i++) {
+    workers.emplace_back(worker);
+  }
+  for (auto& t : workers) {
+    t.join();
+  }
+
+  for (auto& chunk : chunks) {
+    index_result->Merge(chunk.result);
+    index_result->n_pages_read += chunk.n_pages_read;
+    if (chunk.read_failed) {
+      ninja_error("Failed to read page: %u, error: %d(%s)",
+          chunk.failed_page_no, chunk.failed_errno,
+          strerror(chunk.failed_errno));
+      return false;
+    }
+    if (chunk.parse_failed) {
+      ninja_error("Error occurred while parsing page %u at level %u, "
+                  "Skipping analysis for this level.",
+                  chunk.failed_page_no, level);
+      break;
+    }
+  }
+  return true;
+}
+
+void ibdNinja::PrefetchExtent(uint32_t page_no, uint32_t* advised_extent) {
+  uint32_t extent_size = space_->extent_size();
+  if (page_no / extent_size == *advised_extent) {
+    return;
+  }
+  *advised_extent = page_no / extent_size;
+  space_->AdvisePages(*advised_extent * extent_size, extent_size,
+                      MADV_WILLNEED);
+  if (io_depth_ > 1 && !space_->mapped()) {
+    off_t extent_len = static_cast<off_t>(extent_size) *
+                       space_->page_physical_size();
+    posix_fadvise(space_->fd(), *advised_extent * extent_len,
+                  extent_len, POSIX_FADV_WILLNEED);
+  }
+}
+
+bool ibdNinja::ParseIndex(Index* index, OutputWriter* writer) {
+  IndexAnalyzeResult index_result;
+  if (!AnalyzeIndex(index, &index_result, writer == nullptr)) {
+    return false;
+  }
+  if (writer != nullptr) {
+    writer->WriteIndex(index, index_result, space_->page_physical_size());
+  } else {
+    PrintIndexAnalysis(index, index_result);
+  }
+  return true;
 }
 
-bool ibdNinja::ParseIndex(Index* index) {
+bool ibdNinja::AnalyzeIndex(Index* index, IndexAnalyzeResult* result,
+                            bool print) {
+  if (g_sample_pages > 0) {
+    return SampleIndex(index, result, print);
+  }
   unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
   memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
   unsigned char* buf = static_cast<unsigned char*>(
-                    ut_align(buf_unalign, g_page_physical_size));
+                    ut_align(buf_unalign, space_->page_physical_size()));
 
-  uint32_t page_no = index->ib_page();
-  std::vector<uint32_t> left_pages_no;
-  bool ret = ToLeftmostLeaf(index, buf, page_no, &left_pages_no);
-  if (!ret) {
+  if (!index->IsIndexParsingRecSupported()) {
     return false;
   }
-  uint32_t n_levels = left_pages_no.size();
-  IndexAnalyzeResult index_result;
-  fprintf(stdout, "\n");
-  for (auto iter : left_pages_no) {
-    fprintf(stdout, "Analyzing index %s at level %u...\n",
-                    index->name().c_str(), --n_levels);
-    index_result.n_level++;
-    uint32_t current_page_no = iter;
-    uint32_t next_page_no = FIL_NULL;
+  // Other jobs may read the same tablespace concurrently, only the reads
+  // of this thread, its I/O threads and its workers are counted
+  uint64_t n_pages_read_start = Tablespace::n_pages_read_by_thread();
+  IndexAnalyzeResult& index_result = *result;
+  space_->AdvisePages(0, n_pages_, MADV_SEQUENTIAL);
+  ninja_pt(print, "\n");
+  // With multiple threads or asynchronous reads, the pages of every level
+  // are collected from the node pointers of the level above while it is
+  // walked. The leaf level is then parsed in parallel, and the other levels
+  // are read ahead with a PageReader.
+  bool collect_children = (n_threads_ > 1 || io_depth_ > 1);
+  std::vector<uint32_t> child_pages_no;
+  bool children_valid = collect_children;
+  // The first page of every level below the root is the child of the first
+  // node pointer of the first page of the level above, taken while that
+  // level is walked, so that no page is read twice
+  uint32_t first_page_no = index->ib_page();
+  uint32_t level = FIL_NULL;
+  while (first_page_no != FIL_NULL) {
+    std::vector<uint32_t> level_pages_no;
+    level_pages_no.swap(child_pages_no);
+    bool level_pages_valid = children_valid && !level_pages_no.empty() &&
+                             level_pages_no.front() == first_page_no;
+    children_valid = collect_children;
+    if (level == 0 && n_threads_ > 1 && level_pages_valid) {
+      ninja_pt(print, "Analyzing index %s at level %u...\n",
+                      index->name().c_str(), level);
+      index_result.n_level++;
+      // The node pointers of the level above list the leaf pages in the
+      // order of their chain
+      uint32_t prev_page_no = FIL_NULL;
+      for (uint32_t leaf_page_no : level_pages_no) {
+        index_result.AddLeafStep(prev_page_no, leaf_page_no,
+                                 space_->extent_size());
+        prev_page_no = leaf_page_no;
+      }
+      if (!ParseLevelParallel(level, level_pages_no, &index_result)) {
+        space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+        return false;
+      }
+      break;
+    }
+    PageReader* reader = nullptr;
+    if (level_pages_valid && io_depth_ > 1 && !space_->mapped()) {
+      reader = new PageReader(space_, &level_pages_no, io_depth_);
+    }
+    size_t level_pos = 0;
+    uint32_t current_page_no = first_page_no;
+    uint32_t prev_page_no = FIL_NULL;
+    uint32_t advised_extent = FIL_NULL;
+    first_page_no = FIL_NULL;
     do {
-      ssize_t bytes = ReadPage(current_page_no, buf);
-      if (bytes != g_page_physical_size) {
+      unsigned char* page = nullptr;
+      if (reader != nullptr && level_pos < level_pages_no.size() &&
+          level_pages_no[level_pos] == current_page_no) {
+        page = reader->Next();
+        level_pos++;
+      } else {
+        if (reader != nullptr) {
+          // The page chain diverged from the node pointers of the level
+          // above, follow the chain with synchronous reads from here on
+          index_result.n_pages_read += reader->n_pages_read();
+          delete reader;
+          reader = nullptr;
+        }
+        PrefetchExtent(current_page_no, &advised_extent);
+        page = space_->GetPage(current_page_no, buf);
+      }
+      if (page == nullptr) {
         ninja_error("Failed to read page: %u, error: %d(%s)",
             current_page_no, errno, strerror(errno));
+        delete reader;
+        space_->AdvisePages(0, n_pages_, MADV_NORMAL);
         return false;
       }
-      uint32_t page_level = ReadFrom2B(buf + PAGE_HEADER + PAGE_LEVEL);
-      if (page_level > 0) {
-        index_result.n_pages_non_leaf++;
-      } else {
-        index_result.n_pages_leaf++;
+      uint32_t page_level = ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL);
+      if (prev_page_no == FIL_NULL) {
+        // The first page of the level
+        unsigned char* first_rec = nullptr;
+        if (page_level >= BTR_MAX_LEVELS ||
+            (level != FIL_NULL && page_level != level) ||
+            (page_level > 0 &&
+             (first_rec = GetFirstUserRec(page)) == nullptr)) {
+          ninja_error("Failed to find leftmost page");
+          delete reader;
+          space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+          return false;
+        }
+        level = page_level;
+        ninja_pt(print, "Analyzing index %s at level %u...\n",
+                        index->name().c_str(), level);
+        index_result.n_level++;
+        if (level > 0) {
+          Record record(first_rec, index, space_);
+          record.GetColumnOffsets();
+          first_page_no = record.GetChildPageNo();
+        }
       }
-      bool ret = ParsePage(current_page_no, &(index_result.recs_result),
-                           false, true);
+      if (level == 0) {
+        index_result.AddLeafStep(prev_page_no, current_page_no,
+                                 space_->extent_size());
+      }
+      prev_page_no = current_page_no;
+      PageAnalysisResult page_result;
+      bool ret = AnalyzePage(current_page_no, page, &page_result);
+      index_result.AddPage(page_level, ret ? &page_result : nullptr);
       if (!ret) {
         ninja_error("Error occurred while parsing page %u at level %u, "
                     "Skipping analysis for this level.",
-                    current_page_no, n_levels);
+                    current_page_no, level);
+        children_valid = false;
         break;
       }
-      next_page_no = ReadFrom4B(buf + FIL_PAGE_NEXT);
-      current_page_no = next_page_no;
+      if (level > 0 && children_valid) {
+        children_valid = CollectChildPages(index, page, &child_pages_no);
+      }
+      current_page_no = ReadFrom4B(page + FIL_PAGE_NEXT);
     } while (current_page_no != FIL_NULL);
+    if (reader != nullptr) {
+      index_result.n_pages_read += reader->n_pages_read();
+      delete reader;
+    }
+    if (level == 0) {
+      break;
+    }
+    level--;
   }
-  fprintf(stdout, "=========================================="
-                  "==========================================\n");
-  fprintf(stdout, "|  INDEX ANALYSIS RESULT                   "
+  space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+  index_result.n_pages_read += Tablespace::n_pages_read_by_thread() -
+                               n_pages_read_start;
+  return true;
+}
+
+// Half width of the 95% confidence interval of the mean of values
+static double ConfidenceError(const std::vector<double>& values) {
+  size_t n = values.size();
+  if (n < 2) {
+    return 0;
+  }
+  double mean = 0;
+  for (double value : values) {
+    mean += value;
+  }
+  mean /= n;
+  double variance = 0;
+  for (double value : values) {
+    variance += (value - mean) * (value - mean);
+  }
+  variance /= (n - 1);
+  return 1.96 * std::sqrt(variance / n);
+}
+
+bool ibdNinja::SampleIndex(Index* index, IndexAnalyzeResult* result,
+                           bool print) {
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+
+  uint64_t n_pages_read_start = Tablespace::n_pages_read_by_thread();
+  uint32_t n_samples = g_sample_pages;
+  // The non-leaf pages near the root are reached by most descents, each
+  // of them is read and analyzed once
+  struct NonLeafPage {
+    uint32_t level = 0;
+    PageAnalysisResult result;
+    std::vector<uint32_t> children;
+  };
+  std::map<uint32_t, NonLeafPage> non_leaf_pages;
+  // Weighted sums of the pages and records of every level
+  std::vector<LevelAnalysisResult> sums;
+  // What each descent alone estimates, the error bounds come from their
+  // spread
+  std::vector<double> n_pages;
+  std::vector<double> n_pages_leaf;
+  std::vector<double> n_recs_leaf;
+  std::vector<double> valid_recs_len_leaf;
+  std::vector<double> deleted_recs_len_leaf;
+  std::vector<double> free_leaf;
+  // Seeded by the index, so that every run samples the same pages
+  std::mt19937_64 rng(index->ib_id());
+
+  ninja_pt(print, "\nSampling %u leaf pages of index %s...\n",
+                  n_samples, index->name().c_str());
+  for (uint32_t i = 0; i < n_samples; i++) {
+    uint32_t page_no = index->ib_page();
+    uint32_t expected_level = FIL_NULL;
+    uint64_t weight = 1;
+    double descent_n_pages = 0;
+    while (true) {
+      NonLeafPage leaf;
+      NonLeafPage* page_info = &leaf;
+      auto iter = non_leaf_pages.find(page_no);
+      if (iter != non_leaf_pages.end()) {
+        page_info = &iter->second;
+      } else {
+        unsigned char* page = space_->GetPage(page_no, buf);
+        if (page == nullptr) {
+          ninja_error("Failed to read page: %u, error: %d(%s)",
+              page_no, errno, strerror(errno));
+          return false;
+        }
+        uint32_t page_level = ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL);
+        if (page_level >= BTR_MAX_LEVELS ||
+            (expected_level != FIL_NULL && page_level != expected_level)) {
+          ninja_error("Page %u is at level %u, which is not expected",
+                      page_no, page_level);
+          return false;
+        }
+        if (page_level > 0) {
+          page_info = &non_leaf_pages[page_no];
+        }
+        page_info->level = page_level;
+        if (!AnalyzePage(page_no, page, &page_info->result) ||
+            (page_level > 0 &&
+             (!CollectChildPages(index, page, &page_info->children) ||
+              page_info->children.empty()))) {
+          ninja_error("Error occurred while parsing page %u at level %u, "
+                      "Skipping the sampling of the index.",
+                      page_no, page_level);
+          return false;
+        }
+      }
+
+      // A page reached through node pointers on pages with n1, n2, ...
+      // records had a chance of 1 / (n1 * n2 * ...) to be sampled, it
+      // stands for that many pages
+      uint32_t level = page_info->level;
+      const PageAnalysisResult& page_result = page_info->result;
+      if (level >= sums.size()) {
+        sums.resize(level + 1);
+      }
+      sums[level].n_pages += weight;
+      sums[level].recs_result.Merge(page_result, weight);
+      descent_n_pages += weight;
+      if (level == 0) {
+        n_pages_leaf.push_back(weight);
+        n_recs_leaf.push_back(
+            static_cast<double>(weight) * page_result.n_recs_leaf);
+        valid_recs_len_leaf.push_back(
+            static_cast<double>(weight) *
+            (page_result.headers_len_leaf + page_result.recs_len_leaf));
+        deleted_recs_len_leaf.push_back(
+            static_cast<double>(weight) * page_result.deleted_recs_len_leaf);
+        free_leaf.push_back(
+            static_cast<double>(weight) * page_result.free_leaf);
+        break;
+      }
+      weight *= page_info->children.size();
+      page_no = page_info->children[rng() % page_info->children.size()];
+      expected_level = level - 1;
+    }
+    n_pages.push_back(descent_n_pages);
+  }
+
+  IndexAnalyzeResult& index_result = *result;
+  index_result.n_level = sums.size();
+  index_result.levels.resize(sums.size());
+  for (size_t level = 0; level < sums.size(); level++) {
+    LevelAnalysisResult& estimate = index_result.levels[level];
+    estimate.n_pages = (sums[level].n_pages + n_samples / 2) / n_samples;
+    estimate.recs_result = sums[level].recs_result;
+    estimate.recs_result.Divide(n_samples);
+    if (level > 0) {
+      index_result.n_pages_non_leaf += estimate.n_pages;
+    } else {
+      index_result.n_pages_leaf += estimate.n_pages;
+    }
+    index_result.recs_result.Merge(estimate.recs_result);
+  }
+  index_result.n_sampled_pages = n_samples;
+  index_result.n_pages_error = ConfidenceError(n_pages);
+  index_result.n_pages_leaf_error = ConfidenceError(n_pages_leaf);
+  index_result.n_recs_leaf_error = ConfidenceError(n_recs_leaf);
+  index_result.valid_recs_len_leaf_error =
+    ConfidenceError(valid_recs_len_leaf);
+  index_result.deleted_recs_len_leaf_error =
+    ConfidenceError(deleted_recs_len_leaf);
+  index_result.free_leaf_error = ConfidenceError(free_leaf);
+  index_result.n_pages_read = Tablespace::n_pages_read_by_thread() -
+                             n_pages_read_start;
+  return true;
+}
+
+static void PrintLengthPercentiles(const char* name,
+                                   const LengthHistogram& lens) {
+  fprintf(stdout, "%-30s %10.1lf %8u %8u %8u %8u\n",
+                  name,
+                  lens.n_values > 0 ?
+                  static_cast<double>(lens.sum) / lens.n_values : 0,
+                  lens.Percentile(0.5), lens.Percentile(0.9),
+                  lens.Percentile(0.99), lens.max);
+}
+
+static void PrintLengthHistogram(const char* name,
+                                 const LengthHistogram& lens) {
+  fprintf(stdout, "\n%s:\n", name);
+  fprintf(stdout, "%23s %14s %10s\n", "Length(B)", "Records", "Records(%)");
+  for (uint32_t i = 0; i < LengthHistogram::N_BUCKETS; i++) {
+    if (lens.buckets[i] == 0) {
+      continue;
+    }
+    char range[32];
+    uint32_t low = LengthHistogram::BucketLow(i);
+    uint32_t high = LengthHistogram::BucketHigh(i);
+    if (low == high) {
+      snprintf(range, sizeof(range), "%u", low);
+    } else if (i == LengthHistogram::N_BUCKETS - 1) {
+      snprintf(range, sizeof(range), "%u+", low);
+    } else {
+      snprintf(range, sizeof(range), "%u-%u", low, high);
+    }
+    fprintf(stdout, "%23s %14" PRIu64 " %10.05lf\n",
+                    range, lens.buckets[i],
+                    Ratio(lens.buckets[i], lens.n_values));
+  }
+}
+
+static void PrintSizeStats(Index* index, const PageAnalysisResult& recs) {
+  // Percentiles are the upper bounds of their histogram buckets, which
+  // are at most 25% above the exact value
+  fprintf(stdout, "\n--------RECORD-SIZES-------------\n");
+  fprintf(stdout, "Valid leaf records count:                         "
+                  "%" PRIu64 "\n",
+                   recs.rec_lens_leaf.n_values);
+  fprintf(stdout, "\n%-30s %10s %8s %8s %8s %8s\n",
+                  "Length(B)", "Avg", "P50", "P90", "P99", "Max");
+  PrintLengthPercentiles("*Record", recs.rec_lens_leaf);
+  PrintLengthPercentiles("*Header", recs.headers_lens_leaf);
+  for (size_t i = 0; i < recs.field_lens_leaf.size() &&
+                     i < index->GetNFields(); i++) {
+    PrintLengthPercentiles(
+        index->GetPhysicalField(i)->column()->name().c_str(),
+        recs.field_lens_leaf[i]);
+  }
+  PrintLengthHistogram("Record length histogram", recs.rec_lens_leaf);
+  PrintLengthHistogram("Header length histogram", recs.headers_lens_leaf);
+}
+
+void ibdNinja::PrintIndexAnalysis(Index* index,
+                                  const IndexAnalyzeResult& index_result) {
+  fprintf(stdout, "=========================================="
+                  "==========================================\n");
+  fprintf(stdout, "|  INDEX ANALYSIS RESULT                   "
                   "                                         |\n");
   fprintf(stdout, "------------------------------------------"
                   "------------------------------------------\n");
@@ -2505,161 +3211,488 @@ bool ibdNinja::ParseIndex(Index* index) {
                    index->ib_page());
   fprintf(stdout, "Num of fields(ALL):                               %u\n",
                    index->GetNFields());
-  assert(left_pages_no.size() == index_result.n_level);
   fprintf(stdout, "Num of levels:                                    %u\n",
                    index_result.n_level);
-  fprintf(stdout, "Num of pages:                                     %u\n"
+  fprintf(stdout, "Num of pages:                                     "
+                  "%" PRIu64 "\n"
                   "                                                  "
-                  "  [Non leaf pages: %u]\n"
+                  "  [Non leaf pages: %" PRIu64 "]\n"
                   "                                                  "
-                  "  [Leaf pages:     %u]\n",
+                  "  [Leaf pages:     %" PRIu64 "]\n",
                    index_result.n_pages_non_leaf + index_result.n_pages_leaf,
                    index_result.n_pages_non_leaf, index_result.n_pages_leaf);
+  fprintf(stdout, "Num of page reads:                                "
+                  "%" PRIu64 "\n",
+                   index_result.n_pages_read);
+  if (g_fast_stats) {
+    fprintf(stdout, "Analysis mode:                                    "
+                    "fast (page headers only)\n"
+                    "                                                  "
+                    "  [Record headers are estimated]\n"
+                    "                                                  "
+                    "  [Delete-marked records are counted as valid]\n");
+  }
+  if (index_result.n_sampled_pages > 0) {
+    fprintf(stdout, "Num of sampled leaf pages:                        %u\n"
+                    "                                                  "
+                    "  [Pages and records are estimated]\n",
+                     index_result.n_sampled_pages);
+  }
+  if (index_result.levels.size() > 1) {
+    // One line per level from the root down to the leaf level
+    fprintf(stdout, "\n--------LEVELS-------------------\n");
+    fprintf(stdout, "%5s %12s %14s %16s %16s %16s %10s\n",
+                    "Level", "Pages", "Records", "Valid(B)", "Deleted(B)",
+                    "Free(B)", "Valid(%)");
+    for (size_t i = index_result.levels.size(); i-- > 0;) {
+      const LevelAnalysisResult& level = index_result.levels[i];
+      const PageAnalysisResult& recs = level.recs_result;
+      bool leaf = (i == 0);
+      uint64_t valid_size = leaf ?
+                            recs.headers_len_leaf + recs.recs_len_leaf :
+                            recs.headers_len_non_leaf +
+                            recs.recs_len_non_leaf;
+      fprintf(stdout, "%5zu %12" PRIu64 " %14" PRIu64 " %16" PRIu64
+                      " %16" PRIu64 " %16" PRIu64 " %10.05lf\n",
+                      i, level.n_pages,
+                      leaf ? recs.n_recs_leaf : recs.n_recs_non_leaf,
+                      valid_size,
+                      leaf ? recs.deleted_recs_len_leaf :
+                             recs.deleted_recs_len_non_leaf,
+                      leaf ? recs.free_leaf : recs.free_non_leaf,
+                      Ratio(valid_size,
+                            level.n_pages * space_->page_physical_size()));
+    }
+  }
   if (index_result.n_level > 1) {
-    uint32_t total_pages_size = index_result.n_pages_non_leaf *
-                                g_page_physical_size;
+    uint64_t total_pages_size = index_result.n_pages_non_leaf *
+                                space_->page_physical_size();
     // Print non-leaf pages statistic
     fprintf(stdout, "\n--------NON-LEAF-LEVELS--------\n");
     fprintf(stdout, "Total pages count:                                "
-                    "%u\n",
+                    "%" PRIu64 "\n",
                      index_result.n_pages_non_leaf);
     fprintf(stdout, "Total pages size:                                 "
-                    "%u B\n",
+                    "%" PRIu64 " B\n",
                      total_pages_size);
 
     fprintf(stdout, "\n");
     fprintf(stdout, "Total valid records count:                        "
-                    "%u\n",
+                    "%" PRIu64 "\n",
                      index_result.recs_result.n_recs_non_leaf);
     fprintf(stdout, "Total valid records size:                         "
-                    "%u B\n"
+                    "%" PRIu64 " B\n"
                     "                                                  "
-                    "  [Headers: %u B]\n"
+                    "  [Headers: %" PRIu64 " B]\n"
                     "                                                  "
-                    "  [Bodies:  %u B]\n",
+                    "  [Bodies:  %" PRIu64 " B]\n",
                      index_result.recs_result.headers_len_non_leaf +
                      index_result.recs_result.recs_len_non_leaf,
                      index_result.recs_result.headers_len_non_leaf,
                      index_result.recs_result.recs_len_non_leaf);
     fprintf(stdout, "Valid records to non-leaf pages space ratio:      "
         "%02.05lf %%\n",
-        static_cast<double>(
-          (index_result.recs_result.headers_len_non_leaf +
-           index_result.recs_result.recs_len_non_leaf)) /
-        total_pages_size * 100);
-
-    fprintf(stdout, "\n");
-    fprintf(stdout, "Total delete-marked records count:                "
-                    "%u\n",
-                     index_result.recs_result.n_deleted_recs_non_leaf);
-    fprintf(stdout, "Total delete-marked records size:                 "
-                     "%u B\n",
-                     index_result.recs_result.deleted_recs_len_non_leaf);
-    fprintf(stdout, "Delete-marked recs to non-leaf pages space ratio: "
-        "%02.05lf %%\n",
-        static_cast<double>(
-          index_result.recs_result.deleted_recs_len_non_leaf) /
-        total_pages_size * 100);
+        Ratio(index_result.recs_result.headers_len_non_leaf +
+              index_result.recs_result.recs_len_non_leaf,
+              total_pages_size));
+
+    if (!g_fast_stats) {
+      fprintf(stdout, "\n");
+      fprintf(stdout, "Total delete-marked records count:                "
+                      "%" PRIu64 "\n",
+                       index_result.recs_result.n_deleted_recs_non_leaf);
+      fprintf(stdout, "Total delete-marked records size:                 "
+                       "%" PRIu64 " B\n",
+                       index_result.recs_result.deleted_recs_len_non_leaf);
+      fprintf(stdout, "Delete-marked recs to non-leaf pages space ratio: "
+          "%02.05lf %%\n",
+          Ratio(index_result.recs_result.deleted_recs_len_non_leaf,
+                total_pages_size));
+    }
 
     assert(index_result.recs_result.n_contain_dropped_cols_recs_non_leaf == 0);
     assert(index_result.recs_result.dropped_cols_len_non_leaf == 0);
 
     fprintf(stdout, "\n");
     fprintf(stdout, "Total Innodb internal space used:                 "
-                    "%u B\n",
+                    "%" PRIu64 " B\n",
                     index_result.recs_result.innodb_internal_used_non_leaf);
     fprintf(stdout, "InnoDB internals to non-leaf pages space ratio:   "
         "%02.05lf %%\n",
-        static_cast<double>(
-          index_result.recs_result.innodb_internal_used_non_leaf) /
-        total_pages_size * 100);
+        Ratio(index_result.recs_result.innodb_internal_used_non_leaf,
+              total_pages_size));
 
     fprintf(stdout, "\n");
     fprintf(stdout, "Total free space:                                 "
-                    "%u B\n",
+                    "%" PRIu64 " B\n",
                     index_result.recs_result.free_non_leaf);
     fprintf(stdout, "Free space ratio:                                 "
                     "%02.05lf %%\n",
-                     static_cast<double>(
-                      index_result.recs_result.free_non_leaf) /
-                      total_pages_size * 100);
+                     Ratio(index_result.recs_result.free_non_leaf,
+                           total_pages_size));
   }
-  uint32_t total_pages_size = index_result.n_pages_leaf * g_page_physical_size;
+  uint64_t total_pages_size = index_result.n_pages_leaf *
+                              space_->page_physical_size();
   fprintf(stdout, "\n--------LEAF-LEVEL---------------\n");
   fprintf(stdout, "Total pages count:                                "
-                  "%u\n",
+                  "%" PRIu64 "\n",
                    index_result.n_pages_leaf);
   fprintf(stdout, "Total pages size:                                 "
-                  "%u B\n",
+                  "%" PRIu64 " B\n",
                    total_pages_size);
   fprintf(stdout, "\n");
   fprintf(stdout, "Total valid records count:                        "
-                  "%u\n",
+                  "%" PRIu64 "\n",
                    index_result.recs_result.n_recs_leaf);
   fprintf(stdout, "Total valid records size:                         "
-                  "%u B\n"
+                  "%" PRIu64 " B\n"
                   "                                                  "
-                  "  [Headers: %u B]\n"
+                  "  [Headers: %" PRIu64 " B]\n"
                   "                                                  "
-                  "  [Bodies:  %u B]\n",
+                  "  [Bodies:  %" PRIu64 " B]\n",
                    index_result.recs_result.headers_len_leaf +
                    index_result.recs_result.recs_len_leaf,
                    index_result.recs_result.headers_len_leaf,
                    index_result.recs_result.recs_len_leaf);
   fprintf(stdout, "Valid records to leaf pages space ratio:          "
                   "%02.05lf %%\n",
-                   static_cast<double>(
-                   (index_result.recs_result.headers_len_leaf +
-                    index_result.recs_result.recs_len_leaf)) /
-                    total_pages_size * 100);
+                   Ratio(index_result.recs_result.headers_len_leaf +
+                         index_result.recs_result.recs_len_leaf,
+                         total_pages_size));
 
-  fprintf(stdout, "\n");
-  fprintf(stdout, "Total records with instant dropped columns count: "
-                  "%u\n",
-                   index_result.recs_result.n_contain_dropped_cols_recs_leaf);
-  fprintf(stdout, "Total instant dropped columns size:               "
-                  "%u B\n",
-                   index_result.recs_result.dropped_cols_len_leaf);
-  fprintf(stdout, "Dropped columns to leaf pages space ratio:        "
-                  "%02.05lf %%\n",
-                   static_cast<double>(
-                    index_result.recs_result.dropped_cols_len_leaf) /
-                    total_pages_size * 100);
+  // Neither is known without parsing the records
+  if (!g_fast_stats) {
+    fprintf(stdout, "\n");
+    fprintf(stdout, "Total records with instant dropped columns count: "
+                    "%" PRIu64 "\n",
+                     index_result.recs_result.n_contain_dropped_cols_recs_leaf);
+    fprintf(stdout, "Total instant dropped columns size:               "
+                    "%" PRIu64 " B\n",
+                     index_result.recs_result.dropped_cols_len_leaf);
+    fprintf(stdout, "Dropped columns to leaf pages space ratio:        "
+                    "%02.05lf %%\n",
+                     Ratio(index_result.recs_result.dropped_cols_len_leaf,
+                           total_pages_size));
 
-  fprintf(stdout, "\n");
-  fprintf(stdout, "Total delete-marked records count:                "
-                  "%u\n",
-                   index_result.recs_result.n_deleted_recs_leaf);
-  fprintf(stdout, "Total delete-marked records size:                 "
-                   "%u B\n",
-                   index_result.recs_result.deleted_recs_len_leaf);
-  fprintf(stdout, "Delete-marked records to leaf pages space ratio:  "
-                  "%02.05lf %%\n",
-                   static_cast<double>(
-                    index_result.recs_result.deleted_recs_len_leaf) /
-                    total_pages_size * 100);
+    fprintf(stdout, "\n");
+    fprintf(stdout, "Total delete-marked records count:                "
+                    "%" PRIu64 "\n",
+                     index_result.recs_result.n_deleted_recs_leaf);
+    fprintf(stdout, "Total delete-marked records size:                 "
+                     "%" PRIu64 " B\n",
+                     index_result.recs_result.deleted_recs_len_leaf);
+    fprintf(stdout, "Delete-marked records to leaf pages space ratio:  "
+                    "%02.05lf %%\n",
+                     Ratio(index_result.recs_result.deleted_recs_len_leaf,
+                           total_pages_size));
+  }
 
   fprintf(stdout, "\n");
   fprintf(stdout, "Total Innodb internal space used:                 "
-                  "%u B\n",
+                  "%" PRIu64 " B\n",
                    index_result.recs_result.innodb_internal_used_leaf);
   fprintf(stdout, "InnoDB internal space to leaf pages space ratio:  "
                   "%02.05lf %%\n",
-                   static_cast<double>(
-                    index_result.recs_result.innodb_internal_used_leaf) /
-                    total_pages_size * 100);
+                   Ratio(index_result.recs_result.innodb_internal_used_leaf,
+                         total_pages_size));
 
   fprintf(stdout, "\n");
   fprintf(stdout, "Total free space:                                 "
-                  "%u B\n",
+                  "%" PRIu64 " B\n",
                    index_result.recs_result.free_leaf);
   fprintf(stdout, "Free space ratio:                                 "
                   "%02.05lf %%\n",
-                   static_cast<double>(
-                    index_result.recs_result.free_leaf) /
-                    total_pages_size * 100);
+                   Ratio(index_result.recs_result.free_leaf,
+                         total_pages_size));
+
+  if (index_result.HasLeafChain()) {
+    // How far a full scan in key order is from reading the leaf pages
+    // sequentially, a rebuild lays them out in order again
+    fprintf(stdout, "\n--------LEAF-CHAIN---------------\n");
+    fprintf(stdout, "Leaf page discontinuities:                        "
+                    "%" PRIu64 "\n",
+                     index_result.n_leaf_discontinuities);
+    fprintf(stdout, "Average run of consecutive leaf pages:            "
+                    "%.2lf\n",
+                     index_result.LeafAverageRun());
+    fprintf(stdout, "Leaf extent switches:                             "
+                    "%" PRIu64 "\n",
+                     index_result.n_leaf_extent_switches);
+    fprintf(stdout, "Estimated seeks of a full leaf scan:              "
+                    "%" PRIu64 "\n",
+                     index_result.n_leaf_seeks);
+  }
+
+  if (index->HasInstantColsOrRowVersions() && !g_fast_stats) {
+    // Where the valid leaf records are in the INSTANT ADD/DROP history,
+    // the ones at older row versions keep their old layout until the
+    // table is rebuilt
+    const PageAnalysisResult& recs = index_result.recs_result;
+    uint32_t current_row_version = index->table()->ib_current_row_version();
+    RecordGroupStats older;
+    for (uint32_t i = 0; i < current_row_version && i <= MAX_ROW_VERSION;
+         i++) {
+      older.Merge(recs.row_versions[i]);
+    }
+    fprintf(stdout, "\n--------ROW-VERSIONS-------------\n");
+    fprintf(stdout, "Current row version:                              %u\n",
+                     current_row_version);
+    fprintf(stdout, "Records at older row versions count:              "
+                    "%" PRIu64 "\n",
+                     older.n_recs);
+    fprintf(stdout, "Records at older row versions size:               "
+                    "%" PRIu64 " B\n"
+                    "                                                  "
+                    "  [Dropped columns: %" PRIu64 " B]\n",
+                     older.recs_len, older.dropped_cols_len);
+    fprintf(stdout, "Older row versions to valid records ratio:        "
+                    "%02.05lf %%\n",
+                     Ratio(older.n_recs, recs.n_recs_leaf));
+    fprintf(stdout, "\n");
+    fprintf(stdout, "%7s %14s %16s %16s %10s\n",
+                    "Version", "Records", "Size(B)", "Dropped(B)",
+                    "Records(%)");
+    for (uint32_t i = 0; i <= MAX_ROW_VERSION; i++) {
+      const RecordGroupStats& stats = recs.row_versions[i];
+      if (stats.n_recs == 0) {
+        continue;
+      }
+      fprintf(stdout, "%7u %14" PRIu64 " %16" PRIu64 " %16" PRIu64
+                      " %10.05lf\n",
+                      i, stats.n_recs, stats.recs_len,
+                      stats.dropped_cols_len,
+                      Ratio(stats.n_recs, recs.n_recs_leaf));
+    }
+
+    fprintf(stdout, "\n--------INSERT-STATES------------\n");
+    fprintf(stdout, "%14s %16s %16s %10s  %s\n",
+                    "Records", "Size(B)", "Dropped(B)", "Records(%)",
+                    "Inserted");
+    for (uint32_t i = 0; i < REC_N_INSERT_STATES; i++) {
+      const RecordGroupStats& stats = recs.insert_states[i];
+      if (stats.n_recs == 0) {
+        continue;
+      }
+      fprintf(stdout, "%14" PRIu64 " %16" PRIu64 " %16" PRIu64
+                      " %10.05lf  %s\n",
+                      stats.n_recs, stats.recs_len, stats.dropped_cols_len,
+                      Ratio(stats.n_recs, recs.n_recs_leaf),
+                      InsertStateString(static_cast<REC_INSERT_STATE>(i)));
+    }
+  }
+
+  if (g_lob_stats) {
+    fprintf(stdout, "\n--------EXTERNAL-LOBS------------\n");
+    fprintf(stdout, "Total external fields count:                      "
+                    "%" PRIu64 "\n",
+                     index_result.recs_result.n_lob_fields);
+    fprintf(stdout, "Total external pages count:                       "
+                    "%" PRIu64 "\n",
+                     index_result.recs_result.n_lob_pages);
+    fprintf(stdout, "Total external pages size:                        "
+                    "%" PRIu64 " B\n",
+                     index_result.recs_result.n_lob_pages *
+                     space_->page_physical_size());
+    fprintf(stdout, "Total external data size:                         "
+                    "%" PRIu64 " B\n",
+                     index_result.recs_result.lob_data_len);
+    fprintf(stdout, "External data to external pages space ratio:     "
+                    " %02.05lf %%\n",
+                     Ratio(index_result.recs_result.lob_data_len,
+                           index_result.recs_result.n_lob_pages *
+                           space_->page_physical_size()));
+  }
+
+  if (g_size_stats) {
+    PrintSizeStats(index, index_result.recs_result);
+  }
+
+  if (index_result.n_sampled_pages > 0) {
+    // The estimates with the half widths of their 95% confidence intervals
+    const PageAnalysisResult& recs = index_result.recs_result;
+    fprintf(stdout, "\n--------SAMPLING-----------------\n");
+    fprintf(stdout, "Num of sampled leaf pages:                        %u\n",
+                     index_result.n_sampled_pages);
+    fprintf(stdout, "Estimated pages count:                            "
+                    "%" PRIu64 " +/- %.0lf\n",
+                     index_result.n_pages_non_leaf + index_result.n_pages_leaf,
+                     index_result.n_pages_error);
+    fprintf(stdout, "Estimated leaf pages count:                       "
+                    "%" PRIu64 " +/- %.0lf\n",
+                     index_result.n_pages_leaf,
+                     index_result.n_pages_leaf_error);
+    fprintf(stdout, "Estimated leaf valid records count:               "
+                    "%" PRIu64 " +/- %.0lf\n",
+                     recs.n_recs_leaf, index_result.n_recs_leaf_error);
+    fprintf(stdout, "Estimated leaf valid records size:                "
+                    "%" PRIu64 " B +/- %.0lf B\n",
+                     recs.headers_len_leaf + recs.recs_len_leaf,
+                     index_result.valid_recs_len_leaf_error);
+    if (!g_fast_stats) {
+      fprintf(stdout, "Estimated leaf delete-marked records size:        "
+                      "%" PRIu64 " B +/- %.0lf B\n",
+                       recs.deleted_recs_len_leaf,
+                       index_result.deleted_recs_len_leaf_error);
+    }
+    fprintf(stdout, "Estimated leaf free space:                        "
+                    "%" PRIu64 " B +/- %.0lf B\n",
+                     recs.free_leaf, index_result.free_leaf_error);
+  }
 
-  return ret;
+}
+
+bool ibdNinja::ScanFile() {
+  // Read the file front to back in large chunks, ignoring the B+tree links,
+  // and attribute every used INDEX page to its index by PAGE_INDEX_ID
+  static const uint32_t kScanChunkSize = 4 * 1024 * 1024;
+  uint32_t page_size = space_->page_physical_size();
+  uint32_t pages_per_chunk = std::max<uint32_t>(
+                    1, kScanChunkSize / page_size);
+  unsigned char* chunk_unalign =
+    new unsigned char[(pages_per_chunk + 1) * page_size];
+  unsigned char* chunk_buf = static_cast<unsigned char*>(
+                    ut_align(chunk_unalign, page_size));
+  // Page 0 and every XDES page describe the following page size pages,
+  // keep a copy since the chunk buffer is reused
+  unsigned char xdes[UNIV_PAGE_SIZE_MAX];
+  bool xdes_valid = false;
+  uint32_t free_limit = n_pages_;
+  auto is_page_free = [&](uint32_t page_no) {
+    if (page_no >= free_limit) {
+      return true;
+    }
+    if (!xdes_valid) {
+      return false;
+    }
+    const unsigned char* descr = xdes + XDES_ARR_OFFSET + space_->xdes_size() *
+              ((page_no % page_size) / space_->extent_size());
+    uint32_t state = ReadFrom4B(descr + XDES_STATE);
+    if (state == XDES_NOT_INITED || state == XDES_FREE) {
+      return true;
+    }
+    uint32_t bit = (page_no % space_->extent_size()) * XDES_BITS_PER_PAGE +
+                   XDES_FREE_BIT;
+    return ((descr[XDES_BITMAP + bit / 8] >> (bit % 8)) & 1) != 0;
+  };
+
+  std::map<uint64_t, IndexAnalyzeResult> index_results;
+  std::map<uint32_t, uint32_t> n_used_pages_by_type;
+  uint32_t n_free_pages = 0;
+  uint32_t n_stale_index_pages = 0;
+  uint32_t n_unknown_index_pages = 0;
+  uint32_t n_unsupported_index_pages = 0;
+  uint32_t n_failed_pages = 0;
+  uint32_t n_chunks = 0;
+  uint64_t n_pages_read_start = Tablespace::n_pages_read_by_thread();
+
+  fprintf(stdout, "\nScanning %u pages in chunks of %u pages...\n",
+                  n_pages_, pages_per_chunk);
+  space_->AdvisePages(0, n_pages_, MADV_SEQUENTIAL);
+  for (uint32_t first_page_no = 0; first_page_no < n_pages_;
+       first_page_no += pages_per_chunk) {
+    uint32_t n = std::min(pages_per_chunk, n_pages_ - first_page_no);
+    unsigned char* chunk = space_->GetPages(first_page_no, n, chunk_buf);
+    if (chunk == nullptr) {
+      ninja_error("Failed to read pages %u to %u, error: %d(%s)",
+          first_page_no, first_page_no + n - 1, errno, strerror(errno));
+      space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+      delete [] chunk_unalign;
+      return false;
+    }
+    n_chunks++;
+    for (uint32_t i = 0; i < n; i++) {
+      uint32_t page_no = first_page_no + i;
+      unsigned char* page = chunk + i * page_size;
+      uint32_t type = ReadFrom2B(page + FIL_PAGE_TYPE);
+      if (page_no % page_size == 0) {
+        xdes_valid = (type == FIL_PAGE_TYPE_FSP_HDR ||
+                      type == FIL_PAGE_TYPE_XDES);
+        if (xdes_valid) {
+          memcpy(xdes, page, page_size);
+        }
+        if (page_no == 0) {
+          free_limit = ReadFrom4B(page + FSP_HEADER_OFFSET + FSP_FREE_LIMIT);
+        }
+      }
+      if (is_page_free(page_no)) {
+        n_free_pages++;
+        if (type == FIL_PAGE_INDEX) {
+          n_stale_index_pages++;
+        }
+        continue;
+      }
+      n_used_pages_by_type[type]++;
+      if (type != FIL_PAGE_INDEX) {
+        continue;
+      }
+      uint64_t index_id = ReadFrom8B(page + PAGE_HEADER + PAGE_INDEX_ID);
+      Index* index = GetIndex(index_id);
+      if (index == nullptr) {
+        n_unknown_index_pages++;
+        continue;
+      }
+      if (!index->IsIndexParsingRecSupported()) {
+        n_unsupported_index_pages++;
+        continue;
+      }
+      IndexAnalyzeResult& index_result = index_results[index_id];
+      uint32_t page_level = ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL);
+      if (page_level + 1 > index_result.n_level) {
+        index_result.n_level = page_level + 1;
+      }
+      index_result.n_pages_read++;
+      PageAnalysisResult page_result;
+      if (AnalyzePage(page_no, page, &page_result)) {
+        index_result.AddPage(page_level, &page_result);
+      } else {
+        index_result.AddPage(page_level, nullptr);
+        n_failed_pages++;
+      }
+    }
+  }
+  space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+  delete [] chunk_unalign;
+
+  fprintf(stdout, "=========================================="
+                  "==========================================\n");
+  fprintf(stdout, "|  FILE SCAN RESULT                        "
+                  "                                         |\n");
+  fprintf(stdout, "------------------------------------------"
+                  "------------------------------------------\n");
+  fprintf(stdout, "Num of pages scanned:                             %u\n",
+                   n_pages_);
+  fprintf(stdout, "Num of chunks read:                               %u\n"
+                  "                                                  "
+                  "  [Chunk size: %u B]\n",
+                   n_chunks, pages_per_chunk * page_size);
+  fprintf(stdout, "Num of page reads:                                "
+                  "%" PRIu64 "\n",
+                   Tablespace::n_pages_read_by_thread() - n_pages_read_start);
+  fprintf(stdout, "Num of free pages:                                %u\n"
+                  "                                                  "
+                  "  [Stale INDEX pages: %u]\n",
+                   n_free_pages, n_stale_index_pages);
+  fprintf(stdout, "Num of used pages:                                %u\n",
+                   n_pages_ - n_free_pages);
+  for (auto& iter : n_used_pages_by_type) {
+    fprintf(stdout, "                                                  "
+                    "  [%-14s %u]\n",
+                     (PageType2String(iter.first) + ":").c_str(),
+                     iter.second);
+  }
+  fprintf(stdout, "Num of pages of unknown indexes:                  %u\n",
+                   n_unknown_index_pages);
+  fprintf(stdout, "Num of pages of unsupported indexes:              %u\n",
+                   n_unsupported_index_pages);
+  fprintf(stdout, "Num of pages failed to parse:                     %u\n",
+                   n_failed_pages);
+  fprintf(stdout, "\n");
+
+  for (auto& iter : index_results) {
+    PrintIndexAnalysis(GetIndex(iter.first), iter.second);
+    fprintf(stdout, "\n");
+  }
+  return true;
 }
 
 void ibdNinja::ShowTables(bool only_supported) {
@@ -2697,6 +3730,694 @@ void ibdNinja::ShowTables(bool only_supported) {
   }
 }
 
+unsigned char* ibdNinja::SearchPage(Index* index, const SearchKey& key,
+                                    bool le, unsigned char* page,
+                                    uint32_t* rec_no,
+                                    Column** approximated) {
+  uint32_t page_size = space_->page_logical_size();
+  uint32_t n_slots = ReadFrom2B(page + PAGE_HEADER + PAGE_N_DIR_SLOTS);
+  if (n_slots < 2) {
+    ninja_error("Found corrupt page %u", ReadFrom4B(page + FIL_PAGE_OFFSET));
+    return nullptr;
+  }
+  auto slot_rec = [&](uint32_t slot) {
+    return page + ReadFrom2B(page + page_size - PAGE_DIR -
+                             (slot + 1) * PAGE_DIR_SLOT_SIZE);
+  };
+  // Once a record is compared approximately, the search goes on to its
+  // end, but its result is dropped
+  auto is_before = [&](unsigned char* rec) {
+    Record record(rec, index, space_);
+    record.GetColumnOffsets();
+    int cmp = key.Compare(&record, approximated);
+    return cmp > 0 || (le && cmp == 0);
+  };
+
+  // The first slot owns the infimum, the last one the supremum
+  uint32_t low = 0;
+  uint32_t up = n_slots - 1;
+  while (up - low > 1) {
+    uint32_t mid = (low + up) / 2;
+    if (is_before(slot_rec(mid))) {
+      low = mid;
+    } else {
+      up = mid;
+    }
+  }
+  uint32_t n = 0;
+  for (uint32_t slot = 1; slot <= low; slot++) {
+    n += RecGetBitField1B(slot_rec(slot), REC_NEW_N_OWNED,
+                          REC_N_OWNED_MASK, REC_N_OWNED_SHIFT);
+  }
+  unsigned char* rec = slot_rec(low);
+  unsigned char* up_rec = slot_rec(up);
+  for (uint32_t i = 0; i < REC_MAX_N_OWNED; i++) {
+    uint32_t next_offs = RecGetNextOffs(rec, true, page_size);
+    if (next_offs == 0 || next_offs >= page_size) {
+      ninja_error("Found corrupt page %u",
+                  ReadFrom4B(page + FIL_PAGE_OFFSET));
+      return nullptr;
+    }
+    unsigned char* next = page + next_offs;
+    if (next == up_rec || RecGetType(next) == REC_STATUS_SUPREMUM ||
+        !is_before(next)) {
+      break;
+    }
+    rec = next;
+    n++;
+  }
+  if (*approximated != nullptr) {
+    return nullptr;
+  }
+  *rec_no = n;
+  return rec;
+}
+
+bool ibdNinja::SearchLeafPage(Index* index, const SearchKey& key, bool le,
+                              unsigned char* buf, unsigned char** page,
+                              std::vector<uint32_t>* pages_no,
+                              Column** approximated) {
+  uint32_t page_no = index->ib_page();
+  uint32_t level = UINT32_UNDEFINED;
+  while (true) {
+    unsigned char* curr_page = space_->GetPage(page_no, buf);
+    if (curr_page == nullptr) {
+      ninja_error("Failed to read page: %u, error: %d(%s)",
+                  page_no, errno, strerror(errno));
+      return false;
+    }
+    pages_no->push_back(page_no);
+    uint32_t page_level = ReadFrom2B(curr_page + PAGE_HEADER + PAGE_LEVEL);
+    if (PageGetType(curr_page) != FIL_PAGE_INDEX ||
+        ReadFrom8B(curr_page + PAGE_HEADER + PAGE_INDEX_ID) !=
+            index->ib_id() ||
+        (level != UINT32_UNDEFINED && page_level + 1 != level)) {
+      ninja_error("Page %u is not a page of index %s at the expected level",
+                  page_no, index->name().c_str());
+      return false;
+    }
+    if (page_level == 0) {
+      *page = curr_page;
+      return true;
+    }
+    uint32_t rec_no = 0;
+    if (ReadFrom2B(curr_page + PAGE_HEADER + PAGE_N_RECS) == 0) {
+      ninja_error("Found corrupt non-leaf page %u", page_no);
+      return false;
+    }
+    unsigned char* rec = SearchPage(index, key, le, curr_page, &rec_no,
+                                    approximated);
+    if (rec == nullptr) {
+      return false;
+    }
+    if (rec_no == 0) {
+      // The key is before all node pointers, which only happens if the
+      // first one lacks the minimum record flag
+      rec = GetFirstUserRec(curr_page);
+    }
+    Record record(rec, index, space_);
+    record.GetColumnOffsets();
+    page_no = record.GetChildPageNo();
+    level = page_level;
+  }
+}
+
+template <typename Visit>
+bool ibdNinja::WalkLeafLevel(Index* index, unsigned char* buf,
+                             unsigned char* page, unsigned char* rec,
+                             uint32_t rec_no, uint64_t* n_pages_read,
+                             Visit&& visit) {
+  uint32_t page_no = ReadFrom4B(page + FIL_PAGE_OFFSET);
+  while (true) {
+    bool corrupt = false;
+    rec = GetNextRecInPage(rec, page, &corrupt);
+    if (corrupt) {
+      ninja_error("Found corrupt record on page %u", page_no);
+      return false;
+    }
+    if (rec == nullptr) {
+      page_no = ReadFrom4B(page + FIL_PAGE_NEXT);
+      if (page_no == FIL_NULL) {
+        return true;
+      }
+      page = space_->GetPage(page_no, buf);
+      if (page == nullptr) {
+        ninja_error("Failed to read page: %u, error: %d(%s)",
+                    page_no, errno, strerror(errno));
+        return false;
+      }
+      if (PageGetType(page) != FIL_PAGE_INDEX ||
+          ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL) != 0 ||
+          ReadFrom8B(page + PAGE_HEADER + PAGE_INDEX_ID) != index->ib_id()) {
+        ninja_error("Page %u is not a leaf page of index %s",
+                    page_no, index->name().c_str());
+        return false;
+      }
+      (*n_pages_read)++;
+      rec = page + PAGE_NEW_INFIMUM;
+      rec_no = 0;
+      continue;
+    }
+    if (!visit(rec, page_no, ++rec_no)) {
+      return true;
+    }
+  }
+}
+
+bool ibdNinja::LookupRow(uint32_t table_id,
+                         const std::vector<std::string>& key_values) {
+  auto iter = tables_.find(table_id);
+  if (iter == tables_.end()) {
+    ninja_error("Failed to look up the row. "
+                "No table with ID %u was found", table_id);
+    return false;
+  }
+  Table* table = iter->second;
+  Index* index = table->clust_index();
+  if (index == nullptr || !index->IsIndexParsingRecSupported() ||
+      indexes_.find(index->ib_id()) == indexes_.end()) {
+    ninja_error("Failed to look up the row. The records of its "
+                "clustered index can't be parsed");
+    return false;
+  }
+  if (key_values.size() != index->ib_n_uniq()) {
+    ninja_error("Failed to look up the row. The primary key of table %s.%s "
+                "has %u columns, but %zu values are given",
+                table->schema_ref().c_str(), table->name().c_str(),
+                index->ib_n_uniq(), key_values.size());
+    return false;
+  }
+  std::unique_ptr<SearchKey> key(SearchKey::Create(index, key_values));
+  if (key == nullptr) {
+    return false;
+  }
+
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  unsigned char* page = nullptr;
+  unsigned char* rec = nullptr;
+  uint32_t rec_no = 0;
+  std::vector<uint32_t> pages_no;
+  Column* approximated = key->approximated();
+  if (approximated == nullptr &&
+      SearchLeafPage(index, *key, true, buf, &page, &pages_no,
+                     &approximated)) {
+    rec = SearchPage(index, *key, true, page, &rec_no, &approximated);
+  }
+  if (rec == nullptr && approximated == nullptr) {
+    return false;
+  }
+  bool found = false;
+  if (rec != nullptr && rec_no > 0) {
+    Record record(rec, index, space_);
+    record.GetColumnOffsets();
+    found = (key->Compare(&record, &approximated) == 0);
+  }
+
+  fprintf(stdout, "---------------------------------------\n");
+  fprintf(stdout, "Table name: %s.%s\n",
+                   table->schema_ref().c_str(), table->name().c_str());
+  fprintf(stdout, "Index name: %s\n", index->name().c_str());
+  fprintf(stdout, "Key:        %s\n", key->ToString().c_str());
+  if (approximated != nullptr) {
+    return LookupRowInLeafLevel(index, *key, approximated, buf,
+                                pages_no.size());
+  }
+  uint32_t level = pages_no.size() - 1;
+  for (auto page_no : pages_no) {
+    fprintf(stdout, "  Level %u: page %u\n", level, page_no);
+    level--;
+  }
+  fprintf(stdout, "Pages read: %zu\n", pages_no.size());
+  if (!found) {
+    fprintf(stdout, "Found:      no\n");
+    return false;
+  }
+  bool deleted = RecGetDeletedFlag(rec, true);
+  fprintf(stdout, "Found:      row %u of page %u%s\n", rec_no,
+                  pages_no.back(), deleted ? ", delete-marked" : "");
+  Record record(rec, index, space_);
+  record.GetColumnOffsets();
+  PageAnalysisResult result;
+  record.ParseRecord(true, rec_no, &result, true);
+  return true;
+}
+
+bool ibdNinja::LookupRowInLeafLevel(Index* index, const SearchKey& key,
+                                    Column* approximated, unsigned char* buf,
+                                    uint64_t n_pages_read) {
+  fprintf(stdout, "Search:     all leaf pages, column %s can't be compared "
+                  "exactly by its collation %s\n",
+                  approximated->name().c_str(),
+                  approximated->CollationName().c_str());
+  std::vector<uint32_t> pages_no;
+  if (!ToLeftmostLeaf(index, buf, index->ib_page(), &pages_no)) {
+    return false;
+  }
+  uint32_t level = pages_no.size() - 1;
+  for (auto page_no : pages_no) {
+    fprintf(stdout, "  Level %u: page %u\n", level, page_no);
+    level--;
+  }
+  // Every record equal to the key is printed, since more than one may be
+  // equal approximately
+  n_pages_read += pages_no.size();
+  uint64_t n_found = 0;
+  PageAnalysisResult result;
+  bool walked = WalkLeafLevel(index, buf, buf, buf + PAGE_NEW_INFIMUM, 0,
+                              &n_pages_read,
+      [&](unsigned char* rec, uint32_t page_no, uint32_t rec_no) {
+        Record record(rec, index, space_);
+        record.GetColumnOffsets();
+        Column* rec_approximated = nullptr;
+        if (key.Compare(&record, &rec_approximated) != 0) {
+          return true;
+        }
+        n_found++;
+        bool deleted = RecGetDeletedFlag(rec, true);
+        fprintf(stdout, "Found:      row %u of page %u%s%s\n", rec_no,
+                        page_no, deleted ? ", delete-marked" : "",
+                        rec_approximated != nullptr ?
+                        ", compared approximately" : "");
+        record.ParseRecord(true, rec_no, &result, true);
+        return true;
+      });
+  if (!walked) {
+    return false;
+  }
+  fprintf(stdout, "Pages read: %" PRIu64 "\n", n_pages_read);
+  if (n_found == 0) {
+    fprintf(stdout, "Found:      no\n");
+    return false;
+  }
+  return true;
+}
+
+bool ibdNinja::ScanRange(uint32_t index_id,
+                         const std::vector<std::string>& from_values,
+                         const std::vector<std::string>& to_values) {
+  auto iter = indexes_.find(index_id);
+  if (iter == indexes_.end()) {
+    ninja_error("Failed to scan the range. "
+                "No index with ID %u was found", index_id);
+    return false;
+  }
+  Index* index = iter->second;
+  if (!index->IsIndexParsingRecSupported()) {
+    ninja_error("Failed to scan the range. The records of index %s can't "
+                "be parsed", index->name().c_str());
+    return false;
+  }
+  std::unique_ptr<SearchKey> from;
+  std::unique_ptr<SearchKey> to;
+  if (!from_values.empty()) {
+    from.reset(SearchKey::Create(index, from_values));
+    if (from == nullptr) {
+      return false;
+    }
+  }
+  if (!to_values.empty()) {
+    to.reset(SearchKey::Create(index, to_values));
+    if (to == nullptr) {
+      return false;
+    }
+  }
+
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  // Seek to the last record before the range, on the first leaf page that
+  // may hold records of it. If a key can only be compared approximately,
+  // the whole leaf level is filtered instead.
+  Column* approximated = nullptr;
+  if (from != nullptr) {
+    approximated = from->approximated();
+  }
+  if (approximated == nullptr && to != nullptr) {
+    approximated = to->approximated();
+  }
+  unsigned char* page = nullptr;
+  unsigned char* rec = nullptr;
+  std::vector<uint32_t> pages_no;
+  uint64_t n_pages_read = 0;
+  if (from != nullptr && approximated == nullptr) {
+    uint32_t rec_no = 0;
+    if (SearchLeafPage(index, *from, false, buf, &page, &pages_no,
+                       &approximated)) {
+      rec = SearchPage(index, *from, false, page, &rec_no, &approximated);
+    }
+    if (rec == nullptr && approximated == nullptr) {
+      return false;
+    }
+  }
+  bool scan_all = (approximated != nullptr);
+  if (from == nullptr || scan_all) {
+    // The pages of a search that failed are read all the same
+    n_pages_read = pages_no.size();
+    pages_no.clear();
+    if (!ToLeftmostLeaf(index, buf, index->ib_page(), &pages_no)) {
+      return false;
+    }
+    page = buf;
+    rec = page + PAGE_NEW_INFIMUM;
+  }
+
+  fprintf(stdout, "---------------------------------------\n");
+  fprintf(stdout, "Table name: %s.%s\n",
+                   index->table()->schema_ref().c_str(),
+                   index->table()->name().c_str());
+  fprintf(stdout, "Index name: %s\n", index->name().c_str());
+  fprintf(stdout, "From:       %s\n",
+                   from != nullptr ? from->ToString().c_str() : "(first)");
+  fprintf(stdout, "To:         %s\n",
+                   to != nullptr ? to->ToString().c_str() : "(last)");
+  if (scan_all) {
+    fprintf(stdout, "Search:     all leaf pages, column %s can't be "
+                    "compared exactly by its collation %s\n",
+                    approximated->name().c_str(),
+                    approximated->CollationName().c_str());
+  }
+  uint32_t level = pages_no.size() - 1;
+  for (auto page_no : pages_no) {
+    fprintf(stdout, "  Level %u: page %u\n", level, page_no);
+    level--;
+  }
+
+  n_pages_read += pages_no.size();
+  uint64_t n_leaf_pages = 0;
+  uint64_t n_recs = 0;
+  uint64_t n_deleted_recs = 0;
+  uint64_t n_approximated_recs = 0;
+  PageAnalysisResult result;
+  bool walked = WalkLeafLevel(index, buf, page, rec, 0, &n_leaf_pages,
+      [&](unsigned char* rec, uint32_t, uint32_t) {
+        Record record(rec, index, space_);
+        record.GetColumnOffsets();
+        Column* rec_approximated = nullptr;
+        bool in_range = true;
+        if (to != nullptr && to->Compare(&record, &rec_approximated) < 0) {
+          // Only an exact comparison tells that the next records are after
+          // the range too
+          if (rec_approximated == nullptr) {
+            return false;
+          }
+          in_range = false;
+        }
+        if (in_range && scan_all && from != nullptr &&
+            from->Compare(&record, &rec_approximated) > 0) {
+          in_range = false;
+        }
+        if (rec_approximated != nullptr) {
+          if (approximated == nullptr) {
+            approximated = rec_approximated;
+          }
+          n_approximated_recs++;
+        }
+        if (!in_range) {
+          return true;
+        }
+        // Delete-marked records are not part of the index
+        if (RecGetDeletedFlag(rec, true)) {
+          n_deleted_recs++;
+          return true;
+        }
+        n_recs++;
+        record.ParseRecord(true, n_recs, &result, true);
+        return true;
+      });
+  if (!walked) {
+    return false;
+  }
+  n_pages_read += n_leaf_pages;
+  n_leaf_pages++;
+
+  fprintf(stdout, "---------------------------------------\n");
+  fprintf(stdout, "Records:    %" PRIu64 "\n", n_recs);
+  fprintf(stdout, "Skipped:    %" PRIu64 " delete-marked records\n",
+                  n_deleted_recs);
+  if (n_approximated_recs > 0) {
+    fprintf(stdout, "Approximate: %" PRIu64 " records compared "
+                    "approximately, column %s can't be compared exactly "
+                    "by its collation %s\n", n_approximated_recs,
+                    approximated->name().c_str(),
+                    approximated->CollationName().c_str());
+  }
+  fprintf(stdout, "Leaf pages: %" PRIu64 "\n", n_leaf_pages);
+  fprintf(stdout, "Pages read: %" PRIu64 "\n", n_pages_read);
+  return true;
+}
+
+bool ibdNinja::GetSegmentPages(const unsigned char* seg_header,
+                               uint64_t* reserved, uint64_t* used) {
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  uint32_t page_no = ReadFrom4B(seg_header + FSEG_HDR_PAGE_NO);
+  uint32_t offset = ReadFrom2B(seg_header + FSEG_HDR_OFFSET);
+  uint32_t extent_size = space_->extent_size();
+  // A fragment page slot for every other page of an extent
+  uint32_t n_frag_slots = extent_size / 2;
+  unsigned char* page = space_->GetPage(page_no, buf);
+  if (page == nullptr || PageGetType(page) != FIL_PAGE_INODE ||
+      offset + FSEG_FRAG_ARR + n_frag_slots * FSEG_FRAG_SLOT_SIZE >
+      space_->page_logical_size()) {
+    ninja_error("Failed to read the segment inode at page %u, offset %u",
+                page_no, offset);
+    return false;
+  }
+  const unsigned char* inode = page + offset;
+  if (ReadFrom4B(inode + FSEG_MAGIC_N) != FSEG_MAGIC_N_VALUE) {
+    ninja_error("The segment inode at page %u, offset %u is corrupt",
+                page_no, offset);
+    return false;
+  }
+  uint64_t n_frag_pages = 0;
+  for (uint32_t i = 0; i < n_frag_slots; i++) {
+    if (ReadFrom4B(inode + FSEG_FRAG_ARR + i * FSEG_FRAG_SLOT_SIZE) !=
+        FIL_NULL) {
+      n_frag_pages++;
+    }
+  }
+  uint64_t n_full = ReadFrom4B(inode + FSEG_FULL + FLST_LEN);
+  uint64_t n_extents = ReadFrom4B(inode + FSEG_FREE + FLST_LEN) +
+                       ReadFrom4B(inode + FSEG_NOT_FULL + FLST_LEN) + n_full;
+  *reserved += n_frag_pages + n_extents * extent_size;
+  *used += n_frag_pages + ReadFrom4B(inode + FSEG_NOT_FULL_N_USED) +
+           n_full * extent_size;
+  return true;
+}
+
+bool ibdNinja::ComputeIndexStats(Index* index, IndexStats* stats) {
+  // The previous record stays in one buffer while the next leaf page is
+  // read into the other one
+  unsigned char buf_unalign[3 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 3 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* bufs[2];
+  bufs[0] = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  bufs[1] = bufs[0] + UNIV_PAGE_SIZE_MAX;
+
+  // As btr_get_size() does, the size is what both segments reserve, and
+  // the leaf pages are the used pages of the leaf segment
+  unsigned char* root = space_->GetPage(index->ib_page(), bufs[0]);
+  if (root == nullptr) {
+    ninja_error("Failed to read page: %u, error: %d(%s)",
+                index->ib_page(), errno, strerror(errno));
+    return false;
+  }
+  uint64_t n_top_used = 0;
+  if (!GetSegmentPages(root + PAGE_HEADER + PAGE_BTR_SEG_LEAF, &stats->size,
+                       &stats->n_leaf_pages) ||
+      !GetSegmentPages(root + PAGE_HEADER + PAGE_BTR_SEG_TOP, &stats->size,
+                       &n_top_used)) {
+    return false;
+  }
+  // The root alone is in the non-leaf segment
+  stats->n_leaf_pages = std::max<uint64_t>(stats->n_leaf_pages, 1);
+
+  std::vector<uint32_t> pages_no;
+  if (!ToLeftmostLeaf(index, bufs[0], index->ib_page(), &pages_no)) {
+    return false;
+  }
+  uint32_t n_uniq = index->ib_n_uniq();
+  stats->n_diff.assign(n_uniq, 0);
+  KeyMatcher matcher(index, n_uniq);
+  uint32_t n_exact = matcher.n_exact();
+  Record records[2] = {Record(nullptr, index, space_),
+                       Record(nullptr, index, space_)};
+  Record* prev = nullptr;
+  uint32_t cur = 0;
+  uint32_t advised_extent = FIL_NULL;
+  unsigned char* page = bufs[cur];
+  uint32_t page_no = pages_no.back();
+  while (true) {
+    stats->n_sampled_pages++;
+    bool corrupt = false;
+    unsigned char* rec = GetFirstUserRec(page);
+    for (; rec != nullptr && !corrupt;
+         rec = GetNextRecInPage(rec, page, &corrupt)) {
+      // Delete-marked records are left out, as with
+      // innodb_stats_include_delete_marked OFF
+      if (RecGetDeletedFlag(rec, true)) {
+        continue;
+      }
+      Record* record = (prev == &records[0] ? &records[1] : &records[0]);
+      record->Reset(rec);
+      record->GetColumnOffsets();
+      uint32_t n_matched = 0;
+      if (prev != nullptr) {
+        n_matched = matcher.MatchedFields(prev, record, &n_exact);
+      }
+      for (uint32_t i = n_matched; i < n_uniq; i++) {
+        stats->n_diff[i]++;
+      }
+      stats->n_recs++;
+      prev = record;
+    }
+    if (corrupt) {
+      ninja_error("Found corrupt record on page %u", page_no);
+      return false;
+    }
+    page_no = ReadFrom4B(page + FIL_PAGE_NEXT);
+    if (page_no == FIL_NULL) {
+      break;
+    }
+    // Keep the buffer of the previous record
+    if (prev != nullptr && prev->rec() >= page &&
+        prev->rec() < page + space_->page_physical_size()) {
+      cur = 1 - cur;
+    }
+    PrefetchExtent(page_no, &advised_extent);
+    page = space_->GetPage(page_no, bufs[cur]);
+    if (page == nullptr) {
+      ninja_error("Failed to read page: %u, error: %d(%s)",
+                  page_no, errno, strerror(errno));
+      return false;
+    }
+    if (PageGetType(page) != FIL_PAGE_INDEX ||
+        ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL) != 0 ||
+        ReadFrom8B(page + PAGE_HEADER + PAGE_INDEX_ID) != index->ib_id()) {
+      ninja_error("Page %u is not a leaf page of index %s",
+                  page_no, index->name().c_str());
+      return false;
+    }
+  }
+  stats->n_exact = n_exact;
+  return true;
+}
+
+// A string literal of SQL
+static std::string SqlString(const std::string& str) {
+  std::string literal = "'";
+  for (char c : str) {
+    if (c == '\'' || c == '\\') {
+      literal += '\\';
+    }
+    literal += c;
+  }
+  return literal + "'";
+}
+
+bool ibdNinja::ShowIndexStats(uint32_t table_id) {
+  auto iter = tables_.find(table_id);
+  if (iter == tables_.end()) {
+    ninja_error("Failed to compute the index statistics. "
+                "No table with ID %u was found", table_id);
+    return false;
+  }
+  Table* table = iter->second;
+  std::string db_name = SqlString(table->schema_ref());
+  std::string table_name = SqlString(table->name());
+  fprintf(stdout, "-- Persistent statistics of %s.%s\n",
+                  table->schema_ref().c_str(), table->name().c_str());
+  std::vector<std::string> rows;
+  bool complete = true;
+  uint64_t n_rows = 0;
+  uint64_t clustered_index_size = 0;
+  uint64_t sum_of_other_index_sizes = 0;
+  for (auto index : table->indexes()) {
+    if (!index->IsIndexSupported() ||
+        indexes_.find(index->ib_id()) == indexes_.end() ||
+        !index->IsIndexParsingRecSupported()) {
+      fprintf(stdout, "-- Skipping index %s, which is not supported\n",
+                      index->name().c_str());
+      complete = false;
+      continue;
+    }
+    IndexStats stats;
+    if (!ComputeIndexStats(index, &stats)) {
+      ninja_error("Failed to compute the statistics of index %s",
+                  index->name().c_str());
+      return false;
+    }
+    // InnoDB names the clustered index of a table without a primary key
+    std::string index_name = (index->IsClustered() && index->hidden()) ?
+                             "GEN_CLUST_INDEX" : index->name();
+    std::string prefix = "(" + db_name + ", " + table_name + ", " +
+                         SqlString(index_name) + ", NOW(), ";
+    if (stats.n_exact < stats.n_diff.size()) {
+      Column* col = index->GetPhysicalField(stats.n_exact)->column();
+      fprintf(stdout, "-- n_diff_pfx%02u to n_diff_pfx%02zu of index %s are "
+                      "approximate, column %s can't be compared exactly by "
+                      "its collation %s\n",
+                      stats.n_exact + 1, stats.n_diff.size(),
+                      index->name().c_str(), col->name().c_str(),
+                      col->CollationName().c_str());
+    }
+    std::string description;
+    for (size_t i = 0; i < stats.n_diff.size(); i++) {
+      char stat_name[32];
+      snprintf(stat_name, sizeof(stat_name), "'n_diff_pfx%02zu'", i + 1);
+      if (i > 0) {
+        description += ",";
+      }
+      description += index->GetPhysicalField(i)->column()->name();
+      rows.push_back(prefix + stat_name + ", " +
+                     std::to_string(stats.n_diff[i]) + ", " +
+                     std::to_string(stats.n_sampled_pages) + ", " +
+                     SqlString(description) + ")");
+    }
+    rows.push_back(prefix + "'n_leaf_pages', " +
+                   std::to_string(stats.n_leaf_pages) +
+                   ", NULL, 'Number of leaf pages in the index')");
+    rows.push_back(prefix + "'size', " + std::to_string(stats.size) +
+                   ", NULL, 'Number of pages in the index')");
+    if (index->IsClustered()) {
+      n_rows = stats.n_recs;
+      clustered_index_size = stats.size;
+    } else {
+      sum_of_other_index_sizes += stats.size;
+    }
+  }
+
+  fprintf(stdout, "REPLACE INTO mysql.innodb_index_stats (database_name, "
+                  "table_name, index_name, last_update, stat_name, "
+                  "stat_value, sample_size, stat_description) VALUES\n");
+  for (size_t i = 0; i < rows.size(); i++) {
+    fprintf(stdout, "  %s%s\n", rows[i].c_str(),
+                    i + 1 < rows.size() ? "," : ";");
+  }
+  if (complete) {
+    fprintf(stdout, "REPLACE INTO mysql.innodb_table_stats (database_name, "
+                    "table_name, last_update, n_rows, clustered_index_size, "
+                    "sum_of_other_index_sizes) VALUES\n");
+    fprintf(stdout, "  (%s, %s, NOW(), %" PRIu64 ", %" PRIu64 ", %" PRIu64
+                    ");\n",
+                    db_name.c_str(), table_name.c_str(), n_rows,
+                    clustered_index_size, sum_of_other_index_sizes);
+  } else {
+    fprintf(stdout, "-- mysql.innodb_table_stats is left out since not "
+                    "every index is included\n");
+  }
+  fprintf(stdout, "-- Run FLUSH TABLE %s.%s for the server to load them\n",
+                  table->schema_ref().c_str(), table->name().c_str());
+  return true;
+}
+
 void ibdNinja::ShowLeftmostPages(uint32_t index_id) {
   auto iter = indexes_.find(index_id);
   if (iter == indexes_.end()) {
@@ -2708,7 +4429,7 @@ void ibdNinja::ShowLeftmostPages(uint32_t index_id) {
   unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
   memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
   unsigned char* buf = static_cast<unsigned char*>(
-                    ut_align(buf_unalign, g_page_physical_size));
+                    ut_align(buf_unalign, space_->page_physical_size()));
 
   uint32_t page_no = index->ib_page();
   std::vector<uint32_t> left_pages_no;
@@ -2740,6 +4461,18 @@ bool ibdNinja::ParseTable(uint32_t table_id) {
     return false;
   }
   assert(iter->second != nullptr);
+  OutputWriter* writer = OutputWriter::Create(g_output_format, stdout);
+  if (writer != nullptr) {
+    writer->BeginTable(iter->second);
+    for (auto index : iter->second->indexes()) {
+      if (index->IsIndexSupported()) {
+        ParseIndex(index, writer);
+      }
+    }
+    writer->EndTable();
+    delete writer;
+    return true;
+  }
   fprintf(stdout, "=========================================="
                   "==========================================\n");
   fprintf(stdout, "|  TABLE ANALYSIS RESULT                   "
@@ -2756,10 +4489,298 @@ bool ibdNinja::ParseTable(uint32_t table_id) {
   fprintf(stdout, "Analyze each index:\n");
   for (auto index : iter->second->indexes()) {
     if (index->IsIndexSupported()) {
-      ParseIndex(index);
+      ParseIndex(index, nullptr);
+    }
+  }
+  return true;
+}
+
+bool ibdNinja::SplitLeafLevel(Index* index, uint32_t n_chunks,
+                              std::vector<uint32_t>* first_pages_no) {
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  // Go down from the root until a level has enough node pointers, the
+  // subtrees below them cover contiguous key ranges
+  std::vector<uint32_t> pages_no(1, index->ib_page());
+  bool leaf_level = false;
+  while (pages_no.size() < n_chunks && !leaf_level) {
+    std::vector<uint32_t> child_pages_no;
+    for (auto page_no : pages_no) {
+      uint32_t bytes = space_->ReadPage(page_no, buf);
+      if (bytes != space_->page_physical_size()) {
+        ninja_error("Failed to read page: %u, error: %d(%s)",
+                    page_no, errno, strerror(errno));
+        return false;
+      }
+      if (ReadFrom2B(buf + PAGE_HEADER + PAGE_LEVEL) == 0) {
+        leaf_level = true;
+        break;
+      }
+      if (!CollectChildPages(index, buf, &child_pages_no)) {
+        return false;
+      }
+    }
+    if (!leaf_level) {
+      pages_no.swap(child_pages_no);
+    }
+  }
+
+  n_chunks = std::min<size_t>(n_chunks, pages_no.size());
+  for (uint32_t i = 0; i < n_chunks; i++) {
+    uint32_t page_no = pages_no[static_cast<size_t>(i) * pages_no.size() /
+                                n_chunks];
+    std::vector<uint32_t> path_pages_no;
+    if (!ToLeftmostLeaf(index, buf, page_no, &path_pages_no)) {
+      return false;
+    }
+    first_pages_no->push_back(path_pages_no.back());
+  }
+  return true;
+}
+
+bool ibdNinja::ExportLeafPages(Index* index,
+                               const std::vector<Column*>& columns,
+                               const std::vector<uint32_t>& fields_no,
+                               uint32_t first_page_no, uint32_t end_page_no,
+                               const Predicate* where, RowWriter* writer,
+                               ExportResult* result) {
+  unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+  memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+  unsigned char* buf = static_cast<unsigned char*>(
+                    ut_align(buf_unalign, space_->page_physical_size()));
+  // Reused for the whole value of every external field
+  std::string ext_value;
+  uint32_t advised_extent = FIL_NULL;
+  uint32_t page_no = first_page_no;
+  while (page_no != end_page_no && page_no != FIL_NULL) {
+    PrefetchExtent(page_no, &advised_extent);
+    unsigned char* page = space_->GetPage(page_no, buf);
+    if (page == nullptr) {
+      ninja_error("Failed to read page: %u, error: %d(%s)",
+                  page_no, errno, strerror(errno));
+      return false;
+    }
+    if (PageGetType(page) != FIL_PAGE_INDEX ||
+        ReadFrom2B(page + PAGE_HEADER + PAGE_LEVEL) != 0 ||
+        ReadFrom8B(page + PAGE_HEADER + PAGE_INDEX_ID) != index->ib_id()) {
+      ninja_error("Page %u is not a leaf page of index %s",
+                  page_no, index->name().c_str());
+      return false;
+    }
+    result->n_leaf_pages++;
+    unsigned char* rec = nullptr;
+    if (ReadFrom2B(page + PAGE_HEADER + PAGE_N_RECS) > 0) {
+      rec = GetFirstUserRec(page);
+    }
+    bool corrupt = false;
+    while (rec != nullptr) {
+      // Delete-marked records are not part of the table
+      if (!RecGetDeletedFlag(rec, true)) {
+        Record record(rec, index, space_);
+        record.GetColumnOffsets();
+        if (where != nullptr && !where->Matches(&record, &ext_value)) {
+          result->n_unmatched++;
+          rec = GetNextRecInPage(rec, page, &corrupt);
+          continue;
+        }
+        writer->BeginRow();
+        for (size_t i = 0; i < columns.size(); i++) {
+          const unsigned char* data = nullptr;
+          uint32_t len = 0;
+          bool failed = false;
+          if (!record.GetFieldValue(fields_no[i], columns[i], &ext_value,
+                                    &data, &len, &failed)) {
+            if (failed) {
+              result->n_undecoded++;
+            }
+            writer->WriteNull();
+            continue;
+          }
+          FieldValue value;
+          if (columns[i]->Decode(data, len, &value)) {
+            writer->WriteValue(value);
+          } else {
+            result->n_undecoded++;
+            writer->WriteNull();
+          }
+        }
+        writer->EndRow();
+        result->n_rows++;
+      }
+      rec = GetNextRecInPage(rec, page, &corrupt);
+    }
+    if (corrupt) {
+      ninja_error("Found corrupt record on page %u", page_no);
+      return false;
     }
+    page_no = ReadFrom4B(page + FIL_PAGE_NEXT);
   }
   return true;
 }
 
+// Opens the output file, writes the rows of the leaf pages from
+// first_page_no up to end_page_no to it and closes it
+bool ibdNinja::ExportChunk(Table* table, const std::vector<Column*>& columns,
+                           const std::vector<uint32_t>& fields_no,
+                           uint32_t first_page_no, uint32_t end_page_no,
+                           const Predicate* where,
+                           const std::string& out_filename,
+                           const ExportOptions& options,
+                           ExportResult* result) {
+  FILE* file = fopen(out_filename.c_str(), "w");
+  if (file == nullptr) {
+    ninja_error("Failed to open file: %s, error: %d(%s)",
+                out_filename.c_str(), errno, strerror(errno));
+    return false;
+  }
+  RowWriter* writer = RowWriter::Create(options, file);
+  writer->BeginExport(table, columns);
+  bool ret = ExportLeafPages(table->clust_index(), columns, fields_no,
+                             first_page_no, end_page_no, where, writer,
+                             result);
+  writer->EndExport();
+  delete writer;
+  bool write_failed = (ferror(file) != 0);
+  if (fclose(file) != 0 || write_failed) {
+    ninja_error("Failed to write file: %s", out_filename.c_str());
+    ret = false;
+  }
+  return ret;
+}
+
+bool ibdNinja::ExportTable(uint32_t table_id, const char* out_filename,
+                           const ExportOptions& options) {
+  auto iter = tables_.find(table_id);
+  if (iter == tables_.end()) {
+    ninja_error("Failed to export the table. "
+                "No table with ID %u was found", table_id);
+    return false;
+  }
+  Table* table = iter->second;
+  Index* index = table->clust_index();
+  if (index == nullptr || !index->IsIndexParsingRecSupported() ||
+      indexes_.find(index->ib_id()) == indexes_.end()) {
+    ninja_error("Failed to export the table. The records of its "
+                "clustered index can't be parsed");
+    return false;
+  }
+  // The user columns in the order of the table definition, and their
+  // positions in the records of the clustered index
+  std::vector<Column*> columns;
+  std::vector<uint32_t> fields_no;
+  uint32_t n_fields = index->GetNFields();
+  for (auto col : table->columns()) {
+    if (col->is_virtual() || col->IsSystemColumn() ||
+        col->IsColumnDropped() || col->IsSeHidden() ||
+        col->hidden() == Column::HT_HIDDEN_SQL) {
+      continue;
+    }
+    uint32_t field_no = 0;
+    while (field_no < n_fields &&
+           index->GetPhysicalField(field_no)->column() != col) {
+      field_no++;
+    }
+    if (field_no == n_fields) {
+      ninja_error("Failed to export the table. Column %s is not in the "
+                  "clustered index", col->name().c_str());
+      return false;
+    }
+    columns.push_back(col);
+    fields_no.push_back(field_no);
+  }
+  // Compiled once, shared by all the threads
+  std::unique_ptr<Predicate> where;
+  if (!options.where.empty()) {
+    where.reset(Predicate::Create(options.where, columns, fields_no));
+    if (where == nullptr) {
+      return false;
+    }
+  }
+
+  // With multiple threads, the leaf level is split into one key range per
+  // thread, each written to its own file in primary key order
+  std::vector<uint32_t> first_pages_no;
+  if (n_threads_ > 1) {
+    if (!SplitLeafLevel(index, n_threads_, &first_pages_no)) {
+      return false;
+    }
+  } else {
+    unsigned char buf_unalign[2 * UNIV_PAGE_SIZE_MAX];
+    memset(buf_unalign, 0, 2 * UNIV_PAGE_SIZE_MAX);
+    unsigned char* buf = static_cast<unsigned char*>(
+                      ut_align(buf_unalign, space_->page_physical_size()));
+    std::vector<uint32_t> left_pages_no;
+    if (!ToLeftmostLeaf(index, buf, index->ib_page(), &left_pages_no)) {
+      return false;
+    }
+    first_pages_no.push_back(left_pages_no.back());
+  }
+
+  std::vector<ExportResult> results(first_pages_no.size());
+  std::vector<char> chunks_ok(first_pages_no.size(), 0);
+  auto chunk_filename = [&](size_t c) {
+    if (n_threads_ == 1) {
+      return std::string(out_filename);
+    }
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%04zu", c);
+    return std::string(out_filename) + suffix;
+  };
+  space_->AdvisePages(0, n_pages_, MADV_SEQUENTIAL);
+  std::atomic<size_t> next_chunk(0);
+  auto worker = [&]() {
+    size_t c = 0;
+    while ((c = next_chunk.fetch_add(1)) < first_pages_no.size()) {
+      uint32_t end_page_no = (c + 1 < first_pages_no.size() ?
+                              first_pages_no[c + 1] : FIL_NULL);
+      chunks_ok[c] = ExportChunk(table, columns, fields_no,
+                                 first_pages_no[c], end_page_no, where.get(),
+                                 chunk_filename(c), options, &results[c]);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min<size_t>(n_threads_, first_pages_no.size());
+       i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : workers) {
+    t.join();
+  }
+  space_->AdvisePages(0, n_pages_, MADV_NORMAL);
+
+  bool ret = true;
+  ExportResult total;
+  for (size_t c = 0; c < results.size(); c++) {
+    ret = ret && chunks_ok[c];
+    total.n_rows += results[c].n_rows;
+    total.n_leaf_pages += results[c].n_leaf_pages;
+    total.n_undecoded += results[c].n_undecoded;
+    total.n_unmatched += results[c].n_unmatched;
+  }
+  if (total.n_undecoded > 0) {
+    ninja_warn("%" PRIu64 " values could not be decoded and were written "
+               "as NULL", total.n_undecoded);
+  }
+  if (n_threads_ == 1) {
+    fprintf(stdout, "[ibdNinja]: Exported %" PRIu64 " rows of table %s.%s "
+                    "from %" PRIu64 " leaf pages to %s\n",
+                    total.n_rows, table->schema_ref().c_str(),
+                    table->name().c_str(), total.n_leaf_pages, out_filename);
+  } else {
+    fprintf(stdout, "[ibdNinja]: Exported %" PRIu64 " rows of table %s.%s "
+                    "from %" PRIu64 " leaf pages to %zu files %s.NNNN\n",
+                    total.n_rows, table->schema_ref().c_str(),
+                    table->name().c_str(), total.n_leaf_pages,
+                    results.size(), out_filename);
+  }
+  if (where != nullptr) {
+    fprintf(stdout, "[ibdNinja]: Skipped %" PRIu64 " rows not matching "
+                    "--where\n", total.n_unmatched);
+  }
+  return ret;
+}
+
 }  // namespace ibd_ninja
@@ -8,6 +8,10 @@
 #include "Table.h"
 #include "Index.h"
 #include "Record.h"
+#include "Tablespace.h"
+#include "Output.h"
+#include "Predicate.h"
+#include "SearchKey.h"
 
 #include <map>
 #include <string>
@@ -15,13 +19,47 @@
 
 namespace ibd_ninja {
 
+// What --export-table wrote from a range of leaf pages
+struct ExportResult {
+  uint64_t n_rows = 0;
+  uint64_t n_leaf_pages = 0;
+  // Values written as NULL because they could not be fetched or decoded
+  uint64_t n_undecoded = 0;
+  // Rows skipped because they don't match --where
+  uint64_t n_unmatched = 0;
+};
+
+// What InnoDB keeps in mysql.innodb_index_stats for an index
+struct IndexStats {
+  // Number of distinct values of the first 1, 2, ... key fields among the
+  // leaf records that are not delete-marked, NULLs being equal
+  std::vector<uint64_t> n_diff;
+  // Leading key fields whose n_diff is exact. The ones from a character
+  // field that is compared approximately by its collation on are
+  // approximate.
+  uint32_t n_exact = 0;
+  // Leaf records that are not delete-marked
+  uint64_t n_recs = 0;
+  // Leaf pages walked to count them
+  uint64_t n_sampled_pages = 0;
+  // Pages used by the leaf segment, and reserved by both segments
+  uint64_t n_leaf_pages = 0;
+  uint64_t size = 0;
+};
+
 class ibdNinja {
  public:
-  static ibdNinja* CreateNinja(const char* idb_filename);
+  // With print, the file information and the loading result are printed
+  static ibdNinja* CreateNinja(const char* idb_filename, bool print = true);
   ~ibdNinja() {
     for (auto iter : all_tables_) {
       delete iter;
     }
+    delete space_;
+  }
+
+  Tablespace* space() const {
+    return space_;
   }
 
   const std::map<uint64_t, Table*>* tables() const {
@@ -64,15 +102,58 @@ class ibdNinja {
     return idx;
   }
 
-  static ssize_t ReadPage(uint32_t page_no, unsigned char* buf);
   bool ParsePage(uint32_t page_no,
                  PageAnalysisResult* result_aggr,
                  bool print,
                  bool print_record);
+  // Same as above, but parses a page already loaded into buf, which must be
+  // aligned to the page size. With writer, the page is passed to it instead
+  // of being printed.
+  bool ParsePage(uint32_t page_no, unsigned char* buf,
+                 PageAnalysisResult* result_aggr,
+                 bool print,
+                 bool print_record,
+                 OutputWriter* writer = nullptr);
   bool ParseIndex(uint32_t index_id);
+  // Walks the index and fills result without printing the report. It can
+  // be called for several indexes of the same tablespace concurrently.
+  bool AnalyzeIndex(Index* index, IndexAnalyzeResult* result, bool print);
+  void set_n_threads(uint32_t n_threads) {
+    n_threads_ = (n_threads == 0 ? 1 : n_threads);
+  }
+  void set_io_depth(uint32_t io_depth) {
+    io_depth_ = (io_depth == 0 ? 1 : io_depth);
+  }
   void InspectBlob(uint32_t page_no, uint32_t rec_no);
 
   bool ParseTable(uint32_t table_id);
+  // Writes every row of the table to out_filename, walking the leaf level
+  // of the clustered index once. With multiple threads, the rows are split
+  // by primary key ranges into the files out_filename.0000, .0001 and so on.
+  bool ExportTable(uint32_t table_id, const char* out_filename,
+                   const ExportOptions& options);
+  bool ScanFile();
+  // Finds the row of the table with the primary key given by key_values,
+  // one per primary key column, by descending the clustered index from its
+  // root. If the key can't be compared exactly with the ones on the way,
+  // see SearchKey, all leaf pages are searched instead. Returns false if
+  // there is no such row.
+  bool LookupRow(uint32_t table_id,
+                 const std::vector<std::string>& key_values);
+  // Prints the records of the index with keys from from_values up to
+  // to_values, both included, which are values of the first key fields.
+  // The first leaf page is found by descending the index, then the leaf
+  // level is read only until the stop key. Empty values leave the range
+  // open on that side. If a key can't be compared exactly, see SearchKey,
+  // the whole leaf level is read and filtered instead.
+  bool ScanRange(uint32_t index_id,
+                 const std::vector<std::string>& from_values,
+                 const std::vector<std::string>& to_values);
+
+  // Computes the persistent statistics of every index of the table from
+  // a walk of its leaf level, and prints them as statements that replace
+  // the rows of mysql.innodb_index_stats and mysql.innodb_table_stats
+  bool ShowIndexStats(uint32_t table_id);
 
   void ShowTables(bool only_supported);
   void ShowLeftmostPages(uint32_t index_id);
@@ -80,38 +161,136 @@ class ibdNinja {
   static void PrintName();
 
  private:
-  explicit ibdNinja(uint32_t n_pages) : n_pages_(n_pages) {
+  explicit ibdNinja(Tablespace* space) : space_(space),
+                                         n_pages_(space->n_pages()),
+                                         n_threads_(1), io_depth_(1) {
     all_tables_.clear();
     tables_.clear();
     indexes_.clear();
   }
-  static bool SDIToLeftmostLeaf(unsigned char* buf, uint32_t sdi_root,
+  static bool SDIToLeftmostLeaf(Tablespace* space,
+                                unsigned char* buf, uint32_t sdi_root,
                                 uint32_t* leaf_page_no);
-  static uint64_t SDIFetchUncompBlob(uint32_t first_blob_page_no,
+  static uint64_t SDIFetchUncompBlob(Tablespace* space,
+                                     uint32_t first_blob_page_no,
                                      uint64_t total_off_page_length,
                                      unsigned char* dest_buf,
                                      uint32_t* n_ext_pages,
                                      bool* error);
-  static unsigned char* SDIGetFirstUserRec(unsigned char* buf,
+  static unsigned char* SDIGetFirstUserRec(Tablespace* space,
+                                           unsigned char* buf,
                                            uint32_t buf_len);
-  static unsigned char* SDIGetNextRec(unsigned char* current_rec,
+  static unsigned char* SDIGetNextRec(Tablespace* space,
+                                      unsigned char* current_rec,
                                       unsigned char* buf,
                                       uint32_t buf_len,
                                       bool* corrupt);
-  static bool SDIParseRec(unsigned char* rec,
+  static bool SDIParseRec(Tablespace* space, unsigned char* rec,
                           uint64_t* sdi_type, uint64_t* sdi_id,
                           unsigned char** sdi_data, uint64_t* sdi_data_len);
 
-  static unsigned char* GetFirstUserRec(unsigned char* buf);
-  static unsigned char* GetNextRecInPage(unsigned char* current_rec,
-                                         unsigned char* buf,
-                                         bool* corrupt);
-  static bool ToLeftmostLeaf(Index* index,
-                             unsigned char* buf, uint32_t root,
-                             std::vector<uint32_t>* leaf_pages_no);
-  bool ParseIndex(Index* index);
+  unsigned char* GetFirstUserRec(unsigned char* buf);
+  unsigned char* GetNextRecInPage(unsigned char* current_rec,
+                                  unsigned char* buf,
+                                  bool* corrupt);
+  bool ToLeftmostLeaf(Index* index,
+                      unsigned char* buf, uint32_t root,
+                      std::vector<uint32_t>* leaf_pages_no);
+  bool CollectChildPages(Index* index, unsigned char* buf,
+                         std::vector<uint32_t>* child_pages_no);
+  // Returns the last record of the page that is before key, or also equal
+  // to it with le, and its position in rec_no. That is the infimum, at
+  // position 0, if there is none. The page directory is binary searched,
+  // then only the records owned by one slot are walked. Returns nullptr,
+  // after printing why, if the page is corrupt. Also returns nullptr, with
+  // the column set in *approximated, if a record can only be compared
+  // approximately with key.
+  unsigned char* SearchPage(Index* index, const SearchKey& key, bool le,
+                            unsigned char* page, uint32_t* rec_no,
+                            Column** approximated);
+  // Descends from the root of the index to the leaf page that holds the
+  // records around key, following the last node pointer before key (or
+  // equal to it with le) on each level. The leaf page is returned in page,
+  // read into buf, and the pages read on the way in pages_no. Fails like
+  // SearchPage.
+  bool SearchLeafPage(Index* index, const SearchKey& key, bool le,
+                      unsigned char* buf, unsigned char** page,
+                      std::vector<uint32_t>* pages_no,
+                      Column** approximated);
+  // Walks the leaf level of index along FIL_PAGE_NEXT from the record after
+  // rec, at position rec_no of page, which is read into buf. Calls
+  // visit(rec, page_no, rec_no) with every record, rec_no being its
+  // position on its page, until visit returns false. The leaf pages read
+  // after page are counted in n_pages_read. Returns false, after printing
+  // why, if a page can't be read or is not a leaf page of the index.
+  // The part of LookupRow once the key can't be compared exactly with the
+  // records of index, since column is compared approximately. n_pages_read
+  // are the pages already read.
+  bool LookupRowInLeafLevel(Index* index, const SearchKey& key,
+                            Column* approximated, unsigned char* buf,
+                            uint64_t n_pages_read);
+  template <typename Visit>
+  bool WalkLeafLevel(Index* index, unsigned char* buf, unsigned char* page,
+                     unsigned char* rec, uint32_t rec_no,
+                     uint64_t* n_pages_read, Visit&& visit);
+  // Accounts the records of an INDEX page already loaded into buf in
+  // result, without printing. With g_fast_stats, only the page header is
+  // read, see ParsePageHeader.
+  bool AnalyzePage(uint32_t page_no, unsigned char* buf,
+                   PageAnalysisResult* result);
+  // Fills result from PAGE_N_RECS, PAGE_HEAP_TOP, PAGE_GARBAGE and
+  // PAGE_N_DIR_SLOTS. The records count and the space taken by records
+  // are exact, but delete-marked records are counted as valid ones, and
+  // the headers are estimated by Index::EstimateRecHeaderLen.
+  bool ParsePageHeader(uint32_t page_no, unsigned char* buf,
+                       PageAnalysisResult* result);
+  // Estimates the result of AnalyzeIndex from g_sample_pages descents from
+  // the root to a leaf page, each following a node pointer picked at
+  // random on every non-leaf level, as InnoDB samples pages for its
+  // persistent statistics. Every sampled page stands for the pages it had
+  // the same chance to be picked with, so the estimates are unbiased
+  // whatever the shape of the tree.
+  bool SampleIndex(Index* index, IndexAnalyzeResult* result, bool print);
+  // n_diff is counted by comparing every leaf record with the previous
+  // one, so the leaf level is read once, in order
+  bool ComputeIndexStats(Index* index, IndexStats* stats);
+  // Adds the pages of the file segment whose header is at seg_header to
+  // reserved, and the ones in use to used
+  bool GetSegmentPages(const unsigned char* seg_header, uint64_t* reserved,
+                       uint64_t* used);
+  // Prefetches the extent of page_no when a page chain enters it,
+  // advised_extent is the extent prefetched last
+  void PrefetchExtent(uint32_t page_no, uint32_t* advised_extent);
+  bool ParseLevelParallel(uint32_t level,
+                          const std::vector<uint32_t>& pages_no,
+                          IndexAnalyzeResult* index_result);
+  // Picks the first leaf page of up to n_chunks key ranges of about the
+  // same size, split on the node pointers of a non-leaf level
+  bool SplitLeafLevel(Index* index, uint32_t n_chunks,
+                      std::vector<uint32_t>* first_pages_no);
+  // Writes the rows of the leaf pages from first_page_no up to, but not
+  // including, end_page_no
+  bool ExportLeafPages(Index* index, const std::vector<Column*>& columns,
+                       const std::vector<uint32_t>& fields_no,
+                       uint32_t first_page_no, uint32_t end_page_no,
+                       const Predicate* where, RowWriter* writer,
+                       ExportResult* result);
+  bool ExportChunk(Table* table, const std::vector<Column*>& columns,
+                   const std::vector<uint32_t>& fields_no,
+                   uint32_t first_page_no, uint32_t end_page_no,
+                   const Predicate* where, const std::string& out_filename,
+                   const ExportOptions& options, ExportResult* result);
+  // With writer, the result is passed to it instead of being printed
+  bool ParseIndex(Index* index, OutputWriter* writer);
+  void PrintIndexAnalysis(Index* index,
+                          const IndexAnalyzeResult& index_result);
 
+  Tablespace* space_;
   uint32_t n_pages_;
+  uint32_t n_threads_;
+  // Number of reads kept in flight when scanning a level, 1 means
+  // synchronous reads
+  uint32_t io_depth_;
   std::vector<Table*> all_tables_;
   std::map<uint64_t, Table*> tables_;
   std::map<uint64_t, Index*> indexes_;
@@ -170,15 +170,16 @@ std::string PageType2String(uint32_t type) {
   }
 }
 
-int g_fd = 0;
-uint32_t g_page_size_shift = 0;
-uint32_t g_page_logical_size = 0;
-uint32_t g_page_physical_size = 0;
-bool g_page_compressed = false;
+bool g_use_mmap = false;
+bool g_fast_stats = false;
+uint32_t g_sample_pages = 0;
+bool g_size_stats = false;
+OutputFormat g_output_format = OutputFormat::TEXT;
 
 LobOutputFormat g_lob_output_format = LobOutputFormat::HEX;
 bool g_lob_show_version_history = false;
 uint32_t g_lob_text_truncate_len = 256;
+bool g_lob_stats = false;
 
 uint32_t RecGetBitField1B(const unsigned char* rec, uint32_t offs,
                                         uint32_t mask, uint32_t shift) {
@@ -220,8 +221,8 @@ unsigned long ut_align_offset(const void *ptr, unsigned long align_no) {
 }
 
 uint32_t page_offset(
-    const void* ptr) {
-  return (ut_align_offset(ptr, UNIV_PAGE_SIZE));
+    const void* ptr, uint32_t page_size) {
+  return (ut_align_offset(ptr, page_size));
 }
 
 void *ut_align_down(const void *ptr, unsigned long align_no) {
@@ -235,11 +236,12 @@ void *ut_align_down(const void *ptr, unsigned long align_no) {
 }
 
 unsigned char *page_align(
-    const void *ptr) {
-  return ((unsigned char *)ut_align_down(ptr, UNIV_PAGE_SIZE));
+    const void *ptr, uint32_t page_size) {
+  return ((unsigned char *)ut_align_down(ptr, page_size));
 }
 
-uint32_t RecGetNextOffs(const unsigned char* rec, bool comp) {
+uint32_t RecGetNextOffs(const unsigned char* rec, bool comp,
+                        uint32_t page_size) {
   uint32_t field_value;
   static_assert(REC_NEXT_MASK == 0xFFFFUL, "REC_NEXT_MASK != 0xFFFFUL");
   static_assert(REC_NEXT_SHIFT == 0, "REC_NEXT_SHIFT != 0");
@@ -248,7 +250,7 @@ uint32_t RecGetNextOffs(const unsigned char* rec, bool comp) {
 
   if (comp) {
     assert(static_cast<uint16_t>(field_value +
-                                ut_align_offset(rec, UNIV_PAGE_SIZE)));
+                                ut_align_offset(rec, page_size)));
 
     if (field_value == 0) {
       return (0);
@@ -257,11 +259,11 @@ uint32_t RecGetNextOffs(const unsigned char* rec, bool comp) {
     assert((field_value > REC_N_NEW_EXTRA_BYTES && field_value < 32768) ||
           field_value < (uint16_t) - REC_N_NEW_EXTRA_BYTES);
 
-    return (ut_align_offset(rec + field_value, UNIV_PAGE_SIZE));
+    return (ut_align_offset(rec + field_value, page_size));
   } else {
     // TODO(Zhao): Support redundant row format
     assert(0);
-    assert(field_value < UNIV_PAGE_SIZE);
+    assert(field_value < page_size);
 
     return (field_value);
   }
@@ -283,30 +285,31 @@ uint16_t PageGetType(const unsigned char* page) {
   return (static_cast<uint16_t>(ReadFrom2B(page + FIL_PAGE_TYPE)));
 }
 
-bool page_rec_check(const unsigned char* rec) {
-  const unsigned char* page = page_align(rec);
+bool page_rec_check(const unsigned char* rec, uint32_t page_size) {
+  const unsigned char* page = page_align(rec, page_size);
 
   assert(rec);
 
-  assert(page_offset(rec) <= PageHeaderGetField(page, PAGE_HEAP_TOP));
-  assert(page_offset(rec) >= PAGE_DATA);
+  assert(page_offset(rec, page_size) <=
+         PageHeaderGetField(page, PAGE_HEAP_TOP));
+  assert(page_offset(rec, page_size) >= PAGE_DATA);
 
   return true;
 }
 
-bool RecIsInfimum(const unsigned char* rec) {
-  assert(page_rec_check(rec));
-  uint32_t offset = page_offset(rec);
+bool RecIsInfimum(const unsigned char* rec, uint32_t page_size) {
+  assert(page_rec_check(rec, page_size));
+  uint32_t offset = page_offset(rec, page_size);
   assert(offset >= PAGE_NEW_INFIMUM);
-  assert(offset <= UNIV_PAGE_SIZE - PAGE_EMPTY_DIR_START);
+  assert(offset <= page_size - PAGE_EMPTY_DIR_START);
   return (offset == PAGE_NEW_INFIMUM || offset == PAGE_OLD_INFIMUM);
 }
 
-bool RecIsSupremum(const unsigned char* rec) {
-  assert(page_rec_check(rec));
-  uint32_t offset = page_offset(rec);
+bool RecIsSupremum(const unsigned char* rec, uint32_t page_size) {
+  assert(page_rec_check(rec, page_size));
+  uint32_t offset = page_offset(rec, page_size);
   assert(offset >= PAGE_NEW_INFIMUM);
-  assert(offset <= UNIV_PAGE_SIZE - PAGE_EMPTY_DIR_START);
+  assert(offset <= page_size - PAGE_EMPTY_DIR_START);
   return (offset == PAGE_NEW_SUPREMUM || offset == PAGE_OLD_SUPREMUM);
 }
 }  // namespace ibd_ninja
@@ -12,17 +12,34 @@
 
 namespace ibd_ninja {
 
-extern int g_fd;
-extern uint32_t g_page_size_shift;
-extern uint32_t g_page_logical_size;
-extern uint32_t g_page_physical_size;
-extern bool g_page_compressed;
+class Tablespace;
+
+extern bool g_use_mmap;
+// Set by --fast: indexes are analyzed from the page headers only, without
+// parsing their records
+extern bool g_fast_stats;
+// Set by --sample: indexes are analyzed from this number of leaf pages
+// reached by random descents from the root, 0 to analyze every page
+extern uint32_t g_sample_pages;
+// Set by --size-stats: the lengths of the leaf records, their headers and
+// their fields are counted in histograms when analyzing indexes
+extern bool g_size_stats;
+
+// Format of the page, index and table analysis results, set by --format
+enum class OutputFormat { TEXT, JSON, CSV };
+extern OutputFormat g_output_format;
 
 uint8_t ReadFrom1B(const unsigned char* b);
 uint16_t ReadFrom2B(const unsigned char* b);
 uint32_t ReadFrom3B(const unsigned char* b);
 uint32_t ReadFrom4B(const unsigned char* b);
 uint64_t ReadFrom8B(const unsigned char* b);
+// Percentage of part in whole, or 0 if whole is 0. Sizes are passed as
+// 64-bit byte counts, so ratios stay correct for indexes above 4 GB.
+inline double Ratio(uint64_t part, uint64_t whole) {
+  return whole == 0 ? 0 :
+         static_cast<double>(part) / static_cast<double>(whole) * 100;
+}
 // Page size related
 uint32_t PageSizeValidate(uint32_t page_size);
 constexpr uint32_t UNIV_ZIP_SIZE_SHIFT_MIN = 10;
@@ -38,9 +55,8 @@ constexpr uint32_t UNIV_PAGE_SIZE_DEF = 1 << UNIV_PAGE_SIZE_SHIFT_DEF;
 constexpr uint32_t UNIV_PAGE_SIZE_ORIG = 1 << UNIV_PAGE_SIZE_SHIFT_ORIG;
 constexpr uint32_t UNIV_ZIP_SIZE_MIN = 1 << UNIV_ZIP_SIZE_SHIFT_MIN;
 constexpr uint32_t UNIV_ZIP_SIZE_MAX = 1 << UNIV_ZIP_SIZE_SHIFT_MAX;
-#define UNIV_PAGE_SIZE_SHIFT g_page_size_shift
 #define UNIV_PAGE_SSIZE_MAX \
-  static_cast<uint32_t>(UNIV_PAGE_SIZE_SHIFT - UNIV_ZIP_SIZE_SHIFT_MIN + 1)
+  static_cast<uint32_t>(UNIV_PAGE_SIZE_SHIFT_MAX - UNIV_ZIP_SIZE_SHIFT_MIN + 1)
 #define UNIV_PAGE_SSIZE_MIN \
   static_cast<uint32_t>(UNIV_PAGE_SIZE_SHIFT_MIN - UNIV_ZIP_SIZE_SHIFT_MIN + 1)
 
@@ -186,17 +202,24 @@ constexpr uint32_t XDES_BITMAP = FLST_NODE_SIZE + 12;
 constexpr uint32_t XDES_BITS_PER_PAGE = 2;
 constexpr uint32_t XDES_FREE_BIT = 0;
 constexpr uint32_t XDES_CLEAN_BIT = 1;
+// Extent states
+constexpr uint32_t XDES_NOT_INITED = 0;
+constexpr uint32_t XDES_FREE = 1;
+constexpr uint32_t XDES_FREE_FRAG = 2;
+constexpr uint32_t XDES_FULL_FRAG = 3;
+constexpr uint32_t XDES_FSEG = 4;
+constexpr uint32_t XDES_FSEG_FRAG = 5;
 #define UT_BITS_IN_BYTES(b) (((b) + 7UL) / 8UL)
-// TODO(Zhao): double check?
-#define UNIV_PAGE_SIZE ((uint32_t)g_page_logical_size)
-#define FSP_EXTENT_SIZE                                                 \
-  static_cast<uint32_t>(                                               \
-      ((UNIV_PAGE_SIZE <= (16384)                                       \
-            ? (1048576 / UNIV_PAGE_SIZE)                                \
-            : ((UNIV_PAGE_SIZE <= (32768)) ? (2097152 / UNIV_PAGE_SIZE) \
-                                           : (4194304 / UNIV_PAGE_SIZE)))))
-#define XDES_SIZE \
-  (XDES_BITMAP + UT_BITS_IN_BYTES(FSP_EXTENT_SIZE * XDES_BITS_PER_PAGE))
+// Number of pages in an extent of a tablespace with the given logical
+// page size, and the size of its extent descriptor
+constexpr uint32_t FSPExtentSize(uint32_t page_size) {
+  return (page_size <= 16384 ? 1048576 / page_size :
+          (page_size <= 32768 ? 2097152 / page_size : 4194304 / page_size));
+}
+constexpr uint32_t XDESSize(uint32_t page_size) {
+  return XDES_BITMAP +
+         UT_BITS_IN_BYTES(FSPExtentSize(page_size) * XDES_BITS_PER_PAGE);
+}
 #define XDES_SIZE_MAX \
   (XDES_BITMAP + UT_BITS_IN_BYTES(FSP_EXTENT_SIZE_MAX * XDES_BITS_PER_PAGE))
 #define XDES_SIZE_MIN \
@@ -208,6 +231,16 @@ constexpr uint32_t FSEG_HDR_SPACE = 0;
 constexpr uint32_t FSEG_HDR_PAGE_NO = 4;
 constexpr uint32_t FSEG_HDR_OFFSET = 8;
 constexpr uint32_t FSEG_HEADER_SIZE = 10;
+// File segment inode
+constexpr uint32_t FSEG_ID = 0;
+constexpr uint32_t FSEG_NOT_FULL_N_USED = 8;
+constexpr uint32_t FSEG_FREE = 12;
+constexpr uint32_t FSEG_NOT_FULL = FSEG_FREE + FLST_BASE_NODE_SIZE;
+constexpr uint32_t FSEG_FULL = FSEG_NOT_FULL + FLST_BASE_NODE_SIZE;
+constexpr uint32_t FSEG_MAGIC_N = FSEG_FULL + FLST_BASE_NODE_SIZE;
+constexpr uint32_t FSEG_FRAG_ARR = FSEG_MAGIC_N + 4;
+constexpr uint32_t FSEG_FRAG_SLOT_SIZE = 4;
+constexpr uint32_t FSEG_MAGIC_N_VALUE = 97937874;
 
 
 // Page dir related
@@ -276,6 +309,8 @@ constexpr uint32_t DATA_MBR_LEN = SPDIMS * 2 * sizeof(double);
 constexpr uint32_t DICT_MAX_FIXED_COL_LEN = 768;
 
 constexpr uint8_t UINT8_UNDEFINED = std::numeric_limits<uint8_t>::max();
+// Row versions of INSTANT ADD/DROP COLUMN go from 0 to MAX_ROW_VERSION
+const uint8_t MAX_ROW_VERSION = 64;
 constexpr uint32_t UINT32_UNDEFINED = std::numeric_limits<uint32_t>::max();
 
 // Record related
@@ -285,17 +320,18 @@ bool RecGetDeletedFlag(const unsigned char* rec, bool comp);
 static const uint32_t REC_OFF_TYPE = 3;
 uint8_t RecGetType(const unsigned char* rec);
 void *ut_align(const void *ptr, unsigned long align_no);
-uint32_t page_offset(const void *ptr);
+uint32_t page_offset(const void *ptr, uint32_t page_size);
 void *ut_align_down(const void *ptr, unsigned long align_no);
-unsigned char *page_align(const void *ptr);
-uint32_t RecGetNextOffs(const unsigned char* rec, bool comp);
+unsigned char *page_align(const void *ptr, uint32_t page_size);
+uint32_t RecGetNextOffs(const unsigned char* rec, bool comp,
+                        uint32_t page_size);
 uint16_t PageHeaderGetField(const unsigned char* page, uint32_t field);
 uint16_t PageDirGetNHeap(const unsigned char* page);
 bool PageIsCompact(const unsigned char* page);
 uint16_t PageGetType(const unsigned char* page);
-bool page_rec_check(const unsigned char* rec);
-bool RecIsInfimum(const unsigned char* rec);
-bool RecIsSupremum(const unsigned char* rec);
+bool page_rec_check(const unsigned char* rec, uint32_t page_size);
+bool RecIsInfimum(const unsigned char* rec, uint32_t page_size);
+bool RecIsSupremum(const unsigned char* rec, uint32_t page_size);
 constexpr uint32_t REC_OFFS_COMPACT = 1U << 31;
 constexpr uint32_t REC_OFFS_SQL_NULL = 1U << 31;
 constexpr uint32_t REC_OFFS_EXTERNAL = 1 << 30;
@@ -360,6 +396,9 @@ constexpr uint32_t REC_OFFS_HEADER_SIZE = 2;
 constexpr uint32_t REC_OFFS_NORMAL_SIZE = 100;
 constexpr uint32_t REC_OFFS_SMALL_SIZE = 10;
 constexpr uint32_t REC_MAX_N_FIELDS = 1024 - 1;
+// Offsets array of a record with the most fields, see Record::offsets_
+constexpr uint32_t REC_OFFS_MAX_SIZE =
+    REC_MAX_N_FIELDS + (1 + REC_OFFS_HEADER_SIZE);
 constexpr uint32_t REC_MAX_HEAP_NO = 2 * 8192 - 1;
 constexpr uint32_t REC_MAX_N_OWNED = 16 - 1;
 constexpr uint32_t REC_MAX_N_USER_FIELDS =
@@ -437,6 +476,8 @@ constexpr uint32_t PAGE_MAX_TRX_ID = 18;
 constexpr uint32_t PAGE_HEADER_PRIV_END = 26;
 constexpr uint32_t PAGE_LEVEL = 26;
 constexpr uint32_t PAGE_INDEX_ID = 28;
+// Maximum number of levels of a B+tree
+constexpr uint32_t BTR_MAX_LEVELS = 100;
 constexpr uint32_t PAGE_BTR_SEG_LEAF = 36;
 constexpr uint32_t PAGE_BTR_IBUF_FREE_LIST = PAGE_BTR_SEG_LEAF;
 constexpr uint32_t PAGE_BTR_IBUF_FREE_LIST_NODE = PAGE_BTR_SEG_LEAF;
@@ -500,6 +541,8 @@ const uint32_t BTR_EXTERN_LEN = 12;
 const uint32_t BTR_EXTERN_OWNER_FLAG = 128UL;
 const uint32_t BTR_EXTERN_INHERITED_FLAG = 64UL;
 const uint32_t BTR_EXTERN_BEING_MODIFIED_FLAG = 32UL;
+// Size of the reference stored at the end of an external field
+const uint32_t BTR_EXTERN_FIELD_REF_SIZE = 20;
 const uint32_t LOB_HDR_PART_LEN = 0;
 const uint32_t LOB_HDR_NEXT_PAGE_NO = 4;
 const uint32_t LOB_HDR_SIZE = 8;
@@ -549,6 +592,7 @@ enum class LobOutputFormat { HEX, SUMMARY_ONLY };
 extern LobOutputFormat g_lob_output_format;
 extern bool g_lob_show_version_history;
 extern uint32_t g_lob_text_truncate_len;
+extern bool g_lob_stats;
 
 // LOB data structures
 struct FilAddr {
@@ -589,10 +633,22 @@ struct LobFirstPageHeader {
 };
 
 // LOB free function (callable from Record.cc without ibdNinja.h)
-void FetchAndDisplayExternalLob(uint32_t space_id, uint32_t page_no,
+void FetchAndDisplayExternalLob(Tablespace* space,
+                                uint32_t space_id, uint32_t page_no,
                                 uint32_t version, uint64_t ext_len,
                                 LobOutputFormat format,
                                 bool show_versions, bool print);
+// Number of pages occupied by the external field starting at page_no,
+// including old LOB versions, without fetching the data. The bytes the
+// same versions store on these pages are returned in data_len, which is
+// left unchanged if the LOB format is not supported.
+uint32_t CountExternalLobPages(Tablespace* space, uint32_t page_no,
+                               uint64_t* data_len);
+// Fetches the whole value of an external field of len bytes at data into
+// value, starting with the prefix stored in the record. Returns false if
+// the value can't be read completely.
+bool FetchExternalField(Tablespace* space, const unsigned char* data,
+                        uint32_t len, std::string* value);
 
 // Struct to hold info about an external field found in a record
 struct ExternalFieldInfo {
@@ -612,6 +668,11 @@ std::string JsonBinaryToString(const unsigned char* data, size_t len);
 // Index related
 constexpr uint32_t DICT_INDEX_SPATIAL_NODEPTR_SIZE = 1;
 
+// Packed DECIMAL: decimal digits per 4-byte word, and the bytes used by
+// fewer digits
+constexpr int DIG_PER_DEC1 = 9;
+constexpr int dig2bytes[DIG_PER_DEC1 + 1] = {0, 1, 1, 2, 2, 3, 3, 4, 4, 4};
+
 // Others
 #define ULINT_UNDEFINED ~uint32_t{0U}
 }  // namespace ibd_ninja
@@ -2,8 +2,11 @@
  * Copyright (c) [2025-2026] [Zhao Song]
  */
 #include <getopt.h>
+#include <cerrno>
+#include <cstdlib>
 #include <algorithm>
 #include "ibdNinja.h"
+#include "Datadir.h"
 
 void Usage() {
   fprintf(stdout, "Usage: ibdNinja [OPTIONS]\n");
@@ -28,6 +31,25 @@ void Usage() {
                   "specified page\n");
   fprintf(stdout, "    --no-print-record, -n                   Skip printing "
                   "record details when parsing a page\n");
+  fprintf(stdout, "  --scan-file                               Scan the "
+                  "whole file sequentially and analyze all indexes in one "
+                  "pass\n");
+  fprintf(stdout, "  --datadir DIR                             Analyze all "
+                  "ibd files under DIR with a shared pool of --threads "
+                  "workers, tables are reported by wasted space\n");
+  fprintf(stdout, "  --fast                                    Analyze "
+                  "indexes from their page headers only, without parsing "
+                  "records, with --analyze-index, --analyze-table, "
+                  "--scan-file and --datadir\n");
+  fprintf(stdout, "  --sample NUM                              Estimate "
+                  "the analysis of --analyze-index, --analyze-table and "
+                  "--datadir from NUM leaf pages reached by random "
+                  "descents from the root, with 95%% confidence "
+                  "intervals\n");
+  fprintf(stdout, "  --size-stats                              Report "
+                  "the length percentiles and histograms of the leaf "
+                  "records, their headers and their fields with "
+                  "--analyze-index and --analyze-table\n");
   fprintf(stdout, "  --version, -v                             Display version "
                   "information\n");
   fprintf(stdout, "  --blob-format, -b FORMAT                  LOB output format: "
@@ -38,7 +60,71 @@ void Usage() {
                   "history for external fields\n");
   fprintf(stdout, "  --inspect-blob, -I PAGE_NO,REC_NO         Interactive BLOB "
                   "inspection for a specific record\n");
+  fprintf(stdout, "  --lob-stats                               Count the "
+                  "pages and bytes of external LOB fields when analyzing "
+                  "pages and indexes\n");
+  fprintf(stdout, "  --mmap                                    Access the "
+                  "ibd file through a read-only memory mapping instead of "
+                  "pread\n");
+  fprintf(stdout, "  --io-depth NUM                            Number of "
+                  "page reads kept in flight when analyzing an index "
+                  "(default: 1)\n");
+  fprintf(stdout, "  --format FORMAT                           Output "
+                  "format of --parse-page, --analyze-index and "
+                  "--analyze-table: text|json|csv (default: text)\n");
+  fprintf(stdout, "  --export-table TABLE_ID                   Export "
+                  "all rows of the specified table to the file given by "
+                  "--out, split by primary key ranges into one file per "
+                  "thread with --threads\n");
+  fprintf(stdout, "    --out FILE                              Output file "
+                  "of --export-table\n");
+  fprintf(stdout, "    --export-format FORMAT                  Format of "
+                  "--export-table: csv|tsv|jsonl|sql|columnar "
+                  "(default: csv)\n");
+  fprintf(stdout, "    --rows-per-insert NUM                   Rows in "
+                  "each INSERT statement of --export-format sql "
+                  "(default: 1000)\n");
+  fprintf(stdout, "    --where EXPR                            Export only "
+                  "the rows matching EXPR, e.g. \"id > 100 AND name IS NOT "
+                  "NULL\"\n");
+  fprintf(stdout, "  --lookup TABLE_ID KEY...                  Find the "
+                  "row of the specified table with the given primary key "
+                  "values by descending its clustered index, put -- "
+                  "before negative values\n");
+  fprintf(stdout, "  --range INDEX_ID                          Print the "
+                  "records of the specified index with keys from --from up "
+                  "to --to, reading the leaf level only within the range\n");
+  fprintf(stdout, "    --from KEY                              First key of "
+                  "--range, repeated for each key field (default: the "
+                  "first record)\n");
+  fprintf(stdout, "    --to KEY                                Last key of "
+                  "--range, repeated for each key field (default: the "
+                  "last record)\n");
+  fprintf(stdout, "  --index-stats TABLE_ID                    Compute "
+                  "the persistent statistics of every index of the "
+                  "specified table, printed as rows of "
+                  "mysql.innodb_index_stats and innodb_table_stats\n");
+  fprintf(stdout, "  --threads NUM                             Number of "
+                  "threads used to parse leaf pages when analyzing an index "
+                  "(default: 1)\n");
 }
+
+// Parses a decimal option value within [min, max]. Values that are too
+// long to convert are rejected like any other invalid value.
+static bool ParseNumber(const std::string& str, uint64_t min, uint64_t max,
+                        uint32_t* value) {
+  if (str.empty() || !std::all_of(str.begin(), str.end(), ::isdigit)) {
+    return false;
+  }
+  errno = 0;
+  uint64_t num = strtoull(str.c_str(), nullptr, 10);
+  if (errno == ERANGE || num < min || num > max) {
+    return false;
+  }
+  *value = static_cast<uint32_t>(num);
+  return true;
+}
+
 int main(int argc, char* argv[]) {
   if (argc < 2) {
     Usage();
@@ -59,6 +145,26 @@ int main(int argc, char* argv[]) {
     {"blob-truncate", required_argument, 0, 0x100},
     {"lob-versions", no_argument, 0, 'B'},
     {"inspect-blob", required_argument, 0, 'I'},
+    {"threads", required_argument, 0, 0x101},
+    {"lob-stats", no_argument, 0, 0x102},
+    {"mmap", no_argument, 0, 0x103},
+    {"io-depth", required_argument, 0, 0x104},
+    {"scan-file", no_argument, 0, 0x105},
+    {"datadir", required_argument, 0, 0x106},
+    {"format", required_argument, 0, 0x107},
+    {"export-table", required_argument, 0, 0x108},
+    {"out", required_argument, 0, 0x109},
+    {"export-format", required_argument, 0, 0x10A},
+    {"rows-per-insert", required_argument, 0, 0x10B},
+    {"where", required_argument, 0, 0x10C},
+    {"lookup", required_argument, 0, 0x10D},
+    {"range", required_argument, 0, 0x10E},
+    {"from", required_argument, 0, 0x10F},
+    {"to", required_argument, 0, 0x110},
+    {"fast", no_argument, 0, 0x111},
+    {"sample", required_argument, 0, 0x112},
+    {"index-stats", required_argument, 0, 0x113},
+    {"size-stats", no_argument, 0, 0x114},
     {0, 0, 0, 0}  // End of options
   };
 
@@ -76,6 +182,18 @@ int main(int argc, char* argv[]) {
   bool inspect_blob = false;
   uint32_t inspect_page_no = 0;
   uint32_t inspect_rec_no = 0;
+  uint32_t n_threads = 1;
+  uint32_t io_depth = 1;
+  bool scan_file = false;
+  std::string datadir = "";
+  uint32_t export_table_id = ibd_ninja::FIL_NULL;
+  std::string out_file = "";
+  ibd_ninja::ExportOptions export_options;
+  uint32_t lookup_table_id = ibd_ninja::FIL_NULL;
+  uint32_t range_index_id = ibd_ninja::FIL_NULL;
+  std::vector<std::string> range_from;
+  std::vector<std::string> range_to;
+  uint32_t stats_table_id = ibd_ninja::FIL_NULL;
 
   while ((opt = getopt_long(argc,
                 argv, "halvf:e:t:i:p:nb:BI:", options, &option_index)) != -1) {
@@ -99,9 +217,7 @@ int main(int argc, char* argv[]) {
         break;
       case 'e': {
           list_leftmost_pages = true;
-          std::string str(optarg);
-          if (std::all_of(str.begin(), str.end(), ::isdigit)) {
-            index_id = std::stoul(optarg);
+          if (ParseNumber(optarg, 0, UINT32_MAX, &index_id)) {
           } else {
             Usage();
             return 1;
@@ -109,9 +225,7 @@ int main(int argc, char* argv[]) {
         }
         break;
       case 't': {
-          std::string str(optarg);
-          if (std::all_of(str.begin(), str.end(), ::isdigit)) {
-            table_id = std::stoul(optarg);
+          if (ParseNumber(optarg, 0, UINT32_MAX, &table_id)) {
           } else {
             Usage();
             return 1;
@@ -119,9 +233,7 @@ int main(int argc, char* argv[]) {
         }
         break;
       case 'i': {
-          std::string str(optarg);
-          if (std::all_of(str.begin(), str.end(), ::isdigit)) {
-            index_id = std::stoul(optarg);
+          if (ParseNumber(optarg, 0, UINT32_MAX, &index_id)) {
           } else {
             Usage();
             return 1;
@@ -129,9 +241,7 @@ int main(int argc, char* argv[]) {
         }
         break;
       case 'p': {
-          std::string str(optarg);
-          if (std::all_of(str.begin(), str.end(), ::isdigit)) {
-            page_no = std::stoul(optarg);
+          if (ParseNumber(optarg, 0, UINT32_MAX, &page_no)) {
           } else {
             Usage();
             return 1;
@@ -155,15 +265,147 @@ int main(int argc, char* argv[]) {
         }
         break;
       case 0x100: {
-          std::string str(optarg);
-          if (std::all_of(str.begin(), str.end(), ::isdigit)) {
-            ibd_ninja::g_lob_text_truncate_len = std::stoul(optarg);
+          if (ParseNumber(optarg, 0, UINT32_MAX,
+                          &ibd_ninja::g_lob_text_truncate_len)) {
           } else {
             fprintf(stderr, "Invalid blob-truncate value: %s\n", optarg);
             return 1;
           }
         }
         break;
+      case 0x101: {
+          if (ParseNumber(optarg, 1, 256, &n_threads)) {
+          } else {
+            fprintf(stderr, "Invalid threads value: %s "
+                    "(use 1 to 256)\n", optarg);
+            return 1;
+          }
+        }
+        break;
+      case 0x102:
+        ibd_ninja::g_lob_stats = true;
+        break;
+      case 0x103:
+        ibd_ninja::g_use_mmap = true;
+        break;
+      case 0x105:
+        scan_file = true;
+        break;
+      case 0x106:
+        datadir = optarg;
+        break;
+      case 0x107: {
+          std::string fmt(optarg);
+          if (fmt == "text") {
+            ibd_ninja::g_output_format = ibd_ninja::OutputFormat::TEXT;
+          } else if (fmt == "json") {
+            ibd_ninja::g_output_format = ibd_ninja::OutputFormat::JSON;
+          } else if (fmt == "csv") {
+            ibd_ninja::g_output_format = ibd_ninja::OutputFormat::CSV;
+          } else {
+            fprintf(stderr, "Unknown output format: %s "
+                    "(use text, json or csv)\n", optarg);
+            return 1;
+          }
+        }
+        break;
+      case 0x108: {
+          if (ParseNumber(optarg, 0, UINT32_MAX, &export_table_id)) {
+          } else {
+            Usage();
+            return 1;
+          }
+        }
+        break;
+      case 0x109:
+        out_file = optarg;
+        break;
+      case 0x10A: {
+          std::string str(optarg);
+          if (str == "csv") {
+            export_options.format = ibd_ninja::ExportFormat::CSV;
+          } else if (str == "tsv") {
+            export_options.format = ibd_ninja::ExportFormat::TSV;
+          } else if (str == "jsonl") {
+            export_options.format = ibd_ninja::ExportFormat::JSONL;
+          } else if (str == "sql") {
+            export_options.format = ibd_ninja::ExportFormat::SQL;
+          } else if (str == "columnar") {
+            export_options.format = ibd_ninja::ExportFormat::COLUMNAR;
+          } else {
+            fprintf(stderr, "Unknown export format: %s "
+                    "(use csv, tsv, jsonl, sql or columnar)\n", optarg);
+            return 1;
+          }
+        }
+        break;
+      case 0x10B: {
+          if (ParseNumber(optarg, 1, 1000000,
+                          &export_options.rows_per_insert)) {
+          } else {
+            fprintf(stderr, "Invalid rows-per-insert value: %s "
+                    "(use 1 to 1000000)\n", optarg);
+            return 1;
+          }
+        }
+        break;
+      case 0x10C:
+        export_options.where = optarg;
+        break;
+      case 0x10D: {
+          if (ParseNumber(optarg, 0, UINT32_MAX, &lookup_table_id)) {
+          } else {
+            Usage();
+            return 1;
+          }
+        }
+        break;
+      case 0x10E: {
+          if (ParseNumber(optarg, 0, UINT32_MAX, &range_index_id)) {
+          } else {
+            Usage();
+            return 1;
+          }
+        }
+        break;
+      case 0x10F:
+        range_from.push_back(optarg);
+        break;
+      case 0x110:
+        range_to.push_back(optarg);
+        break;
+      case 0x111:
+        ibd_ninja::g_fast_stats = true;
+        break;
+      case 0x114:
+        ibd_ninja::g_size_stats = true;
+        break;
+      case 0x113: {
+          if (ParseNumber(optarg, 0, UINT32_MAX, &stats_table_id)) {
+          } else {
+            Usage();
+            return 1;
+          }
+        }
+        break;
+      case 0x112: {
+          if (ParseNumber(optarg, 2, 1000000, &ibd_ninja::g_sample_pages)) {
+          } else {
+            fprintf(stderr, "Invalid sample value: %s "
+                    "(use 2 to 1000000)\n", optarg);
+            return 1;
+          }
+        }
+        break;
+      case 0x104: {
+          if (ParseNumber(optarg, 1, 256, &io_depth)) {
+          } else {
+            fprintf(stderr, "Invalid io-depth value: %s "
+                    "(use 1 to 256)\n", optarg);
+            return 1;
+          }
+        }
+        break;
       case 'B':
         ibd_ninja::g_lob_show_version_history = true;
         break;
@@ -177,16 +419,13 @@ int main(int argc, char* argv[]) {
           }
           std::string page_str = arg.substr(0, comma);
           std::string rec_str = arg.substr(comma + 1);
-          if (!std::all_of(page_str.begin(), page_str.end(), ::isdigit) ||
-              !std::all_of(rec_str.begin(), rec_str.end(), ::isdigit) ||
-              page_str.empty() || rec_str.empty()) {
+          if (!ParseNumber(page_str, 0, UINT32_MAX, &inspect_page_no) ||
+              !ParseNumber(rec_str, 0, UINT32_MAX, &inspect_rec_no)) {
             fprintf(stderr, "Invalid format for --inspect-blob. "
                     "Use: -I PAGE_NO,REC_NO\n");
             return 1;
           }
           inspect_blob = true;
-          inspect_page_no = std::stoul(page_str);
-          inspect_rec_no = std::stoul(rec_str);
         }
         break;
       case '?':
@@ -197,6 +436,91 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  bool structured_output =
+    (ibd_ninja::g_output_format != ibd_ninja::OutputFormat::TEXT);
+  if (structured_output &&
+      (!datadir.empty() || list_tables || list_all_tables ||
+       list_leftmost_pages || inspect_blob || scan_file ||
+       export_table_id != ibd_ninja::FIL_NULL ||
+       lookup_table_id != ibd_ninja::FIL_NULL ||
+       range_index_id != ibd_ninja::FIL_NULL ||
+       stats_table_id != ibd_ninja::FIL_NULL ||
+       (table_id == ibd_ninja::FIL_NULL &&
+        index_id == ibd_ninja::FIL_NULL &&
+        page_no == ibd_ninja::FIL_NULL))) {
+    fprintf(stderr, "--format json and csv are only supported with "
+                    "--parse-page, --analyze-index and --analyze-table\n");
+    return 1;
+  }
+
+  if (export_table_id != ibd_ninja::FIL_NULL && out_file.empty()) {
+    fprintf(stderr, "--export-table requires the output file given by "
+                    "--out\n");
+    return 1;
+  }
+  // The key values of --lookup are the arguments left after the options
+  std::vector<std::string> lookup_key;
+  for (int i = optind; i < argc; i++) {
+    lookup_key.push_back(argv[i]);
+  }
+  if (lookup_table_id != ibd_ninja::FIL_NULL && lookup_key.empty()) {
+    fprintf(stderr, "--lookup requires the primary key values after the "
+                    "options\n");
+    return 1;
+  }
+
+  if ((!range_from.empty() || !range_to.empty()) &&
+      range_index_id == ibd_ninja::FIL_NULL) {
+    fprintf(stderr, "--from and --to are only supported with --range\n");
+    return 1;
+  }
+
+  if (!export_options.where.empty() &&
+      export_table_id == ibd_ninja::FIL_NULL) {
+    fprintf(stderr, "--where is only supported with --export-table\n");
+    return 1;
+  }
+
+  if (ibd_ninja::g_fast_stats) {
+    if (datadir.empty() && !scan_file &&
+        table_id == ibd_ninja::FIL_NULL &&
+        (index_id == ibd_ninja::FIL_NULL || list_leftmost_pages)) {
+      fprintf(stderr, "--fast is only supported with --analyze-index, "
+                      "--analyze-table, --scan-file and --datadir\n");
+      return 1;
+    }
+    if (ibd_ninja::g_lob_stats) {
+      fprintf(stderr, "--lob-stats can't be used with --fast, external "
+                      "fields are only found by parsing records\n");
+      return 1;
+    }
+    if (ibd_ninja::g_size_stats) {
+      fprintf(stderr, "--size-stats can't be used with --fast, record "
+                      "lengths are only found by parsing records\n");
+      return 1;
+    }
+  }
+
+  if (ibd_ninja::g_sample_pages > 0 && datadir.empty() &&
+      table_id == ibd_ninja::FIL_NULL &&
+      (index_id == ibd_ninja::FIL_NULL || list_leftmost_pages)) {
+    fprintf(stderr, "--sample is only supported with --analyze-index, "
+                    "--analyze-table and --datadir\n");
+    return 1;
+  }
+
+  if (ibd_ninja::g_size_stats && table_id == ibd_ninja::FIL_NULL &&
+      (index_id == ibd_ninja::FIL_NULL || list_leftmost_pages)) {
+    fprintf(stderr, "--size-stats is only supported with --analyze-index "
+                    "and --analyze-table\n");
+    return 1;
+  }
+
+  if (!datadir.empty()) {
+    ibd_ninja::Datadir dir(datadir, n_threads, io_depth);
+    return dir.Analyze() ? 0 : 1;
+  }
+
   if (ibd_file.empty()) {
     fprintf(stderr, "You must specify the ibd file using the "
                     "--file (-f) option.\n");
@@ -204,15 +528,27 @@ int main(int argc, char* argv[]) {
   }
 
   ibd_ninja::ibdNinja* ninja =
-    ibd_ninja::ibdNinja::CreateNinja(ibd_file.c_str());
+    ibd_ninja::ibdNinja::CreateNinja(ibd_file.c_str(), !structured_output);
+  int ret = 0;
 
   if (ninja != nullptr) {
+    ninja->set_n_threads(n_threads);
+    ninja->set_io_depth(io_depth);
     if (list_tables) {
       ninja->ShowTables(true);
     } else if (list_all_tables) {
       ninja->ShowTables(false);
     } else if (list_leftmost_pages) {
       ninja->ShowLeftmostPages(index_id);
+    } else if (export_table_id != ibd_ninja::FIL_NULL) {
+      ret = ninja->ExportTable(export_table_id, out_file.c_str(),
+                               export_options) ? 0 : 1;
+    } else if (range_index_id != ibd_ninja::FIL_NULL) {
+      ret = ninja->ScanRange(range_index_id, range_from, range_to) ? 0 : 1;
+    } else if (lookup_table_id != ibd_ninja::FIL_NULL) {
+      ret = ninja->LookupRow(lookup_table_id, lookup_key) ? 0 : 1;
+    } else if (stats_table_id != ibd_ninja::FIL_NULL) {
+      ret = ninja->ShowIndexStats(stats_table_id) ? 0 : 1;
     } else if (table_id != ibd_ninja::FIL_NULL) {
       ninja->ParseTable(table_id);
     } else if (index_id != ibd_ninja::FIL_NULL) {
@@ -221,10 +557,12 @@ int main(int argc, char* argv[]) {
       ninja->InspectBlob(inspect_page_no, inspect_rec_no);
     } else if (page_no != ibd_ninja::FIL_NULL) {
       ninja->ParsePage(page_no, nullptr, true, print_record);
+    } else if (scan_file) {
+      ninja->ScanFile();
     } else {
       ninja->ShowTables(true);
     }
     delete ninja;
   }
-  return 0;
+  return ret;
 }
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `ddl_test` (`id`,`original_col1`,`verify_column`,`data_v3`,`data_v5`) VALUES (1,'original_data_1',666,NULL,NULL),(2,'original_data_2',666,NULL,NULL),(3,'original_data_3',666,NULL,NULL),(4,'after_add_v2_1',666,NULL,NULL),(5,'after_add_v2_2',666,NULL,NULL),(6,'after_add_v3_1',666,'{\"key\":\"value1\"}',NULL),(7,'after_add_v3_2',666,'{\"key\":\"value2\"}',NULL),(8,'before_8040_changes_1',666,'{\"key\":\"value3\"}',NULL),(9,'before_8040_changes_2',666,'{\"key\":\"value4\"}',NULL),(10,'after_8040_add_v4_1',666,'{\"key\":\"value5\"}',NULL),(11,'after_8040_add_v4_2',666,'{\"key\":\"value6\"}',NULL),(12,'after_8040_add_v5_1',666,'{\"key\":\"value7\"}','123.45'),(13,'after_8040_add_v5_2',666,'{\"key\":\"value8\"}','678.90'),(14,'after_drop_original_1',666,'{\"key\":\"value9\"}','777.77'),(15,'after_drop_original_2',666,'{\"key\":\"value10\"}','888.88'),(16,'after_drop_8016col_1',666,'{\"key\":\"value11\"}','999.99'),(17,'after_drop_8016col_2',666,'{\"key\":\"value12\"}','111.11'),(18,'final_data_1',666,'{\"key\":\"value13\"}','222.22'),(19,'final_data_2',666,'{\"key\":\"value14\"}','333.33');
@@ -0,0 +1,8 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `fragmented_leaves` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (1,'First01','Last01','user01@example.com',20,'2024-02-02 09:01:00'),(2,'First02','Last02','user02@example.com',30,'2024-02-03 09:02:00'),(3,'First03','Last03','user03@example.com',10,'2024-02-04 09:03:00'),(4,'First04','Last04','user04@example.com',20,'2024-02-05 09:04:00'),(5,'First05','Last05','user05@example.com',30,'2024-02-06 09:05:00'),(6,'First06','Last06','user06@example.com',10,'2024-02-07 09:06:00'),(7,'First07','Last00','user07@example.com',20,'2024-02-08 09:07:00'),(8,'First08','Last01','user08@example.com',30,'2024-02-09 09:08:00'),(9,'First09','Last02','user09@example.com',10,'2024-02-10 09:09:00');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `fragmented_leaves` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (10,'First10','Last03','user10@example.com',20,'2024-02-11 09:10:00'),(11,'First11','Last04','user11@example.com',30,'2024-02-12 09:11:00'),(12,'First12','Last05','user12@example.com',10,'2024-02-13 09:12:00'),(13,'First13','Last06','user13@example.com',20,'2024-02-14 09:13:00'),(14,'First14','Last00','user14@example.com',30,'2024-02-15 09:14:00'),(15,'First15','Last01','user15@example.com',10,'2024-02-16 09:15:00'),(16,'First16','Last02','user16@example.com',20,'2024-02-17 09:16:00'),(17,'First17','Last03','user17@example.com',30,'2024-02-18 09:17:00'),(18,'First18','Last04','user18@example.com',10,'2024-02-19 09:18:00'),(19,'First19','Last05','user19@example.com',20,'2024-02-20 09:19:00'),(20,'First20','Last06','user20@example.com',30,'2024-02-21 09:20:00'),(21,'First21','Last00','user21@example.com',10,'2024-02-22 09:21:00');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `fragmented_leaves` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (22,'First22','Last01','user22@example.com',20,'2024-02-23 09:22:00'),(23,'First23','Last02','user23@example.com',30,'2024-02-24 09:23:00'),(24,'First24','Last03','user24@example.com',10,'2024-02-25 09:24:00'),(25,'First25','Last04','user25@example.com',20,'2024-02-26 09:25:00'),(26,'First26','Last05','user26@example.com',30,'2024-02-27 09:26:00'),(27,'First27','Last06','user27@example.com',10,'2024-02-28 09:27:00'),(28,'First28','Last00','user28@example.com',20,'2024-02-01 09:28:00'),(29,'First29','Last01','user29@example.com',30,'2024-02-02 09:29:00'),(30,'First30','Last02','user30@example.com',10,'2024-02-03 09:30:00');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `fragmented_leaves` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (31,'First31','Last03','user31@example.com',20,'2024-02-04 09:31:00'),(32,'First32','Last04','user32@example.com',30,'2024-02-05 09:32:00'),(33,'First33','Last05','user33@example.com',10,'2024-02-06 09:33:00'),(34,'First34','Last06','user34@example.com',20,'2024-02-07 09:34:00'),(35,'First35','Last00','user35@example.com',30,'2024-02-08 09:35:00'),(36,'First36','Last01','user36@example.com',10,'2024-02-09 09:36:00'),(37,'First37','Last02','user37@example.com',20,'2024-02-10 09:37:00'),(38,'First38','Last03','user38@example.com',30,'2024-02-11 09:38:00'),(39,'First39','Last04','user39@example.com',10,'2024-02-12 09:39:00'),(40,'First40','Last05','user40@example.com',20,'2024-02-13 09:40:00'),(41,'First41','Last06','user41@example.com',30,'2024-02-14 09:41:00'),(42,'First42','Last00','user42@example.com',10,'2024-02-15 09:42:00');
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `instant_add_drop` (`col_uint`,`col_datetime_0`,`col_datetime_6`) VALUES (1,'2026-01-16 09:53:48',NULL),(2,'2026-01-16 09:53:48','2026-01-16 09:53:48.000000'),(3,'2026-01-16 09:53:48','2026-01-16 09:53:48.000000');
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `multi_index` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (1,'John','Smith','john.smith@example.com',10,'2024-01-15 10:00:00'),(2,'Jane','Doe','jane.doe@example.com',20,'2024-01-16 11:00:00'),(3,'Bob','Smith','bob.smith@example.com',10,'2024-01-17 12:00:00'),(4,'Alice','Johnson','alice.j@example.com',30,'2024-01-18 13:00:00'),(5,'Charlie','Brown','charlie.b@example.com',20,'2024-01-19 14:00:00');
@@ -0,0 +1,11 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `multi_page` (`id`,`data`) VALUES (1,'Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-Data-1-'),(2,'Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-Data-2-'),(3,'Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-Data-3-'),(4,'Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-Data-4-'),(5,'Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-Data-5-'),(6,'Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-Data-6-'),(7,'Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-Data-7-'),(8,'Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-Data-8-'),(9,'Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-Data-9-'),(10,'Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-Data-10-'),(11,'Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-Data-11-'),(12,'Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-Data-12-'),(13,'Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-Data-13-'),(14,'Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-Data-14-'),(15,'Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-Data-15-'),(16,'Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-Data-16-'),(17,'Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-Data-17-'),(18,'Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-Data-18-'),(19,'Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-Data-19-'),(20,'Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-Data-20-'),(21,'Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-Data-21-'),(22,'Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-Data-22-'),(23,'Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-Data-23-'),(24,'Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-Data-24-'),(25,'Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-Data-25-'),(26,'Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-Data-26-'),(27,'Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-Data-27-'),(28,'Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-Data-28-'),(29,'Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-Data-29-'),(30,'Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-Data-30-'),(31,'Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-Data-31-'),(32,'Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-Data-32-'),(33,'Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-Data-33-'),(34,'Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-Data-34-'),(35,'Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-Data-35-'),(36,'Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-Data-36-'),(37,'Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-Data-37-'),(38,'Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-Data-38-'),(39,'Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-Data-39-'),(40,'Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-Data-40-'),(41,'Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-Data-41-'),(42,'Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-Data-42-'),(43,'Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-Data-43-'),(44,'Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-Data-44-'),(45,'Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-Data-45-'),(46,'Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-Data-46-'),(47,'Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-Data-47-'),(48,'Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-Data-48-'),(49,'Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-Data-49-'),(50,'Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-Data-50-'),(51,'Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-Data-51-'),(52,'Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-Data-52-'),(53,'Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-Data-53-'),(54,'Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-Data-54-'),(55,'Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-Data-55-'),(56,'Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-Data-56-'),(57,'Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-Data-57-'),(58,'Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-Data-58-'),(59,'Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-Data-59-'),(60,'Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-Data-60-'),(61,'Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-Data-61-'),(62,'Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-Data-62-'),(63,'Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-Data-63-'),(64,'Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-Data-64-'),(65,'Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-Data-65-'),(66,'Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-Data-66-'),(67,'Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-Data-67-'),(68,'Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-Data-68-'),(69,'Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-Data-69-'),(70,'Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-Data-70-'),(71,'Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-Data-71-'),(72,'Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-Data-72-'),(73,'Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-Data-73-'),(74,'Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-Data-74-'),(75,'Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-Data-75-'),(76,'Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-Data-76-'),(77,'Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-Data-77-'),(78,'Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-Data-78-'),(79,'Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-Data-79-'),(80,'Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-Data-80-'),(81,'Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-Data-81-'),(82,'Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-Data-82-'),(83,'Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-Data-83-'),(84,'Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-Data-84-'),(85,'Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-Data-85-'),(86,'Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-Data-86-');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `multi_page` (`id`,`data`) VALUES (87,'Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-Data-87-'),(88,'Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-Data-88-'),(89,'Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-Data-89-'),(90,'Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-Data-90-'),(91,'Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-Data-91-'),(92,'Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-Data-92-'),(93,'Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-Data-93-'),(94,'Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-Data-94-'),(95,'Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-Data-95-'),(96,'Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-Data-96-'),(97,'Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-Data-97-'),(98,'Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-Data-98-'),(99,'Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-Data-99-'),(100,'Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-Data-100-'),(101,'Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-Data-101-'),(102,'Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-Data-102-'),(103,'Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-Data-103-'),(104,'Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-Data-104-'),(105,'Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-Data-105-'),(106,'Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-Data-106-'),(107,'Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-Data-107-'),(108,'Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-Data-108-'),(109,'Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-Data-109-'),(110,'Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-Data-110-'),(111,'Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-Data-111-'),(112,'Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-Data-112-'),(113,'Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-Data-113-'),(114,'Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-Data-114-'),(115,'Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-Data-115-'),(116,'Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-Data-116-'),(117,'Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-Data-117-'),(118,'Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-Data-118-'),(119,'Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-Data-119-'),(120,'Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-Data-120-'),(121,'Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-Data-121-'),(122,'Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-Data-122-'),(123,'Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-Data-123-'),(124,'Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-Data-124-'),(125,'Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-Data-125-'),(126,'Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-Data-126-'),(127,'Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-Data-127-'),(128,'Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-Data-128-'),(129,'Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-Data-129-'),(130,'Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-Data-130-'),(131,'Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-Data-131-'),(132,'Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-Data-132-'),(133,'Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-Data-133-'),(134,'Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-Data-134-'),(135,'Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-Data-135-'),(136,'Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-Data-136-'),(137,'Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-Data-137-'),(138,'Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-Data-138-'),(139,'Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-Data-139-'),(140,'Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-Data-140-'),(141,'Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-Data-141-'),(142,'Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-Data-142-'),(143,'Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-Data-143-'),(144,'Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-Data-144-'),(145,'Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-Data-145-'),(146,'Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-Data-146-'),(147,'Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-Data-147-'),(148,'Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-Data-148-'),(149,'Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-Data-149-'),(150,'Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-Data-150-'),(151,'Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-Data-151-'),(152,'Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-Data-152-'),(153,'Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-Data-153-'),(154,'Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-Data-154-'),(155,'Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-Data-155-'),(156,'Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-Data-156-'),(157,'Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-Data-157-'),(158,'Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-Data-158-'),(159,'Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-Data-159-'),(160,'Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-Data-160-'),(161,'Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-Data-161-'),(162,'Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-Data-162-'),(163,'Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-Data-163-'),(164,'Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-Data-164-'),(165,'Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-Data-165-'),(166,'Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-Data-166-'),(167,'Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-Data-167-'),(168,'Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-Data-168-'),(169,'Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-Data-169-'),(170,'Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-Data-170-'),(171,'Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-Data-171-'),(172,'Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-Data-172-'),(173,'Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-Data-173-'),(174,'Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-Data-174-'),(175,'Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-Data-175-'),(176,'Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-Data-176-'),(177,'Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-Data-177-'),(178,'Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-Data-178-'),(179,'Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-Data-179-'),(180,'Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-Data-180-'),(181,'Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-Data-181-'),(182,'Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-Data-182-'),(183,'Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-Data-183-'),(184,'Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-Data-184-'),(185,'Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-Data-185-'),(186,'Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-Data-186-');
+INSERT INTO `multi_page` (`id`,`data`) VALUES (187,'Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-Data-187-'),(188,'Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-Data-188-'),(189,'Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-Data-189-'),(190,'Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-Data-190-'),(191,'Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-Data-191-'),(192,'Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-Data-192-'),(193,'Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-Data-193-'),(194,'Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-Data-194-'),(195,'Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-Data-195-'),(196,'Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-Data-196-'),(197,'Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-Data-197-'),(198,'Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-Data-198-'),(199,'Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-Data-199-'),(200,'Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-Data-200-'),(201,'Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-Data-201-'),(202,'Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-Data-202-'),(203,'Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-Data-203-'),(204,'Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-Data-204-'),(205,'Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-Data-205-'),(206,'Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-Data-206-'),(207,'Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-Data-207-'),(208,'Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-Data-208-'),(209,'Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-Data-209-'),(210,'Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-Data-210-'),(211,'Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-Data-211-'),(212,'Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-Data-212-'),(213,'Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-Data-213-'),(214,'Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-Data-214-'),(215,'Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-Data-215-'),(216,'Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-Data-216-'),(217,'Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-Data-217-'),(218,'Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-Data-218-'),(219,'Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-Data-219-'),(220,'Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-Data-220-'),(221,'Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-Data-221-'),(222,'Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-Data-222-'),(223,'Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-Data-223-'),(224,'Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-Data-224-'),(225,'Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-Data-225-'),(226,'Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-Data-226-'),(227,'Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-Data-227-'),(228,'Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-Data-228-'),(229,'Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-Data-229-'),(230,'Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-Data-230-'),(231,'Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-Data-231-'),(232,'Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-Data-232-'),(233,'Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-Data-233-'),(234,'Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-Data-234-'),(235,'Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-Data-235-'),(236,'Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-Data-236-'),(237,'Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-Data-237-'),(238,'Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-Data-238-'),(239,'Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-Data-239-'),(240,'Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-Data-240-');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `multi_page` (`id`,`data`) VALUES (241,'Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-Data-241-'),(242,'Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-Data-242-'),(243,'Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-Data-243-'),(244,'Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-Data-244-'),(245,'Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-Data-245-'),(246,'Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-Data-246-'),(247,'Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-Data-247-'),(248,'Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-Data-248-'),(249,'Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-Data-249-'),(250,'Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-Data-250-'),(251,'Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-Data-251-'),(252,'Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-Data-252-'),(253,'Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-Data-253-'),(254,'Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-Data-254-'),(255,'Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-Data-255-'),(256,'Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-Data-256-'),(257,'Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-Data-257-'),(258,'Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-Data-258-'),(259,'Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-Data-259-'),(260,'Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-Data-260-'),(261,'Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-Data-261-'),(262,'Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-Data-262-'),(263,'Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-Data-263-'),(264,'Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-Data-264-'),(265,'Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-Data-265-'),(266,'Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-Data-266-'),(267,'Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-Data-267-'),(268,'Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-Data-268-'),(269,'Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-Data-269-'),(270,'Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-Data-270-'),(271,'Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-Data-271-'),(272,'Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-Data-272-'),(273,'Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-Data-273-'),(274,'Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-Data-274-'),(275,'Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-Data-275-'),(276,'Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-Data-276-'),(277,'Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-Data-277-'),(278,'Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-Data-278-'),(279,'Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-Data-279-'),(280,'Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-Data-280-'),(281,'Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-Data-281-'),(282,'Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-Data-282-'),(283,'Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-Data-283-'),(284,'Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-Data-284-'),(285,'Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-Data-285-'),(286,'Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-Data-286-'),(287,'Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-Data-287-'),(288,'Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-Data-288-'),(289,'Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-Data-289-'),(290,'Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-Data-290-'),(291,'Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-Data-291-'),(292,'Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-Data-292-'),(293,'Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-Data-293-'),(294,'Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-Data-294-'),(295,'Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-Data-295-'),(296,'Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-Data-296-'),(297,'Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-Data-297-'),(298,'Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-Data-298-'),(299,'Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-Data-299-'),(300,'Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-Data-300-'),(301,'Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-Data-301-'),(302,'Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-Data-302-'),(303,'Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-Data-303-'),(304,'Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-Data-304-'),(305,'Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-Data-305-'),(306,'Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-Data-306-'),(307,'Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-Data-307-'),(308,'Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-Data-308-'),(309,'Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-Data-309-'),(310,'Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-Data-310-'),(311,'Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-Data-311-'),(312,'Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-Data-312-'),(313,'Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-Data-313-'),(314,'Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-Data-314-'),(315,'Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-Data-315-'),(316,'Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-Data-316-'),(317,'Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-Data-317-'),(318,'Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-Data-318-'),(319,'Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-Data-319-'),(320,'Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-Data-320-'),(321,'Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-Data-321-'),(322,'Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-Data-322-'),(323,'Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-Data-323-'),(324,'Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-Data-324-'),(325,'Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-Data-325-'),(326,'Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-Data-326-'),(327,'Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-Data-327-'),(328,'Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-Data-328-'),(329,'Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-Data-329-'),(330,'Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-Data-330-'),(331,'Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-Data-331-'),(332,'Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-Data-332-'),(333,'Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-Data-333-'),(334,'Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-Data-334-'),(335,'Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-Data-335-'),(336,'Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-Data-336-'),(337,'Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-Data-337-'),(338,'Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-Data-338-'),(339,'Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-Data-339-'),(340,'Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-Data-340-');
+INSERT INTO `multi_page` (`id`,`data`) VALUES (341,'Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-Data-341-'),(342,'Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-Data-342-'),(343,'Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-Data-343-'),(344,'Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-Data-344-'),(345,'Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-Data-345-'),(346,'Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-Data-346-'),(347,'Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-Data-347-'),(348,'Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-Data-348-'),(349,'Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-Data-349-'),(350,'Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-Data-350-'),(351,'Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-Data-351-'),(352,'Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-Data-352-'),(353,'Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-Data-353-'),(354,'Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-Data-354-'),(355,'Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-Data-355-'),(356,'Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-Data-356-'),(357,'Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-Data-357-'),(358,'Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-Data-358-'),(359,'Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-Data-359-'),(360,'Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-Data-360-'),(361,'Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-Data-361-'),(362,'Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-Data-362-'),(363,'Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-Data-363-'),(364,'Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-Data-364-'),(365,'Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-Data-365-'),(366,'Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-Data-366-'),(367,'Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-Data-367-'),(368,'Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-Data-368-'),(369,'Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-Data-369-'),(370,'Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-Data-370-'),(371,'Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-Data-371-'),(372,'Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-Data-372-'),(373,'Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-Data-373-'),(374,'Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-Data-374-'),(375,'Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-Data-375-'),(376,'Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-Data-376-'),(377,'Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-Data-377-'),(378,'Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-Data-378-'),(379,'Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-Data-379-'),(380,'Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-Data-380-'),(381,'Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-Data-381-'),(382,'Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-Data-382-'),(383,'Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-Data-383-'),(384,'Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-Data-384-'),(385,'Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-Data-385-'),(386,'Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-Data-386-'),(387,'Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-Data-387-'),(388,'Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-Data-388-'),(389,'Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-Data-389-'),(390,'Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-Data-390-'),(391,'Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-Data-391-'),(392,'Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-Data-392-'),(393,'Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-Data-393-');
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `multi_page` (`id`,`data`) VALUES (394,'Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-Data-394-'),(395,'Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-Data-395-'),(396,'Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-Data-396-'),(397,'Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-Data-397-'),(398,'Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-Data-398-'),(399,'Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-Data-399-'),(400,'Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-Data-400-'),(401,'Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-Data-401-'),(402,'Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-Data-402-'),(403,'Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-Data-403-'),(404,'Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-Data-404-'),(405,'Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-Data-405-'),(406,'Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-Data-406-'),(407,'Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-Data-407-'),(408,'Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-Data-408-'),(409,'Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-Data-409-'),(410,'Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-Data-410-'),(411,'Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-Data-411-'),(412,'Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-Data-412-'),(413,'Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-Data-413-'),(414,'Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-Data-414-'),(415,'Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-Data-415-'),(416,'Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-Data-416-'),(417,'Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-Data-417-'),(418,'Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-Data-418-'),(419,'Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-Data-419-'),(420,'Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-Data-420-'),(421,'Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-Data-421-'),(422,'Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-Data-422-'),(423,'Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-Data-423-'),(424,'Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-Data-424-'),(425,'Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-Data-425-'),(426,'Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-Data-426-'),(427,'Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-Data-427-'),(428,'Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-Data-428-'),(429,'Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-Data-429-'),(430,'Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-Data-430-'),(431,'Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-Data-431-'),(432,'Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-Data-432-'),(433,'Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-Data-433-'),(434,'Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-Data-434-'),(435,'Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-Data-435-'),(436,'Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-Data-436-'),(437,'Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-Data-437-'),(438,'Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-Data-438-'),(439,'Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-Data-439-'),(440,'Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-Data-440-'),(441,'Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-Data-441-'),(442,'Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-Data-442-'),(443,'Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-Data-443-'),(444,'Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-Data-444-'),(445,'Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-Data-445-'),(446,'Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-Data-446-'),(447,'Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-Data-447-'),(448,'Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-Data-448-'),(449,'Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-Data-449-'),(450,'Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-Data-450-'),(451,'Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-Data-451-'),(452,'Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-Data-452-'),(453,'Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-Data-453-'),(454,'Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-Data-454-'),(455,'Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-Data-455-'),(456,'Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-Data-456-'),(457,'Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-Data-457-'),(458,'Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-Data-458-'),(459,'Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-Data-459-'),(460,'Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-Data-460-'),(461,'Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-Data-461-'),(462,'Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-Data-462-'),(463,'Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-Data-463-'),(464,'Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-Data-464-'),(465,'Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-Data-465-'),(466,'Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-Data-466-'),(467,'Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-Data-467-'),(468,'Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-Data-468-'),(469,'Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-Data-469-'),(470,'Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-Data-470-'),(471,'Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-Data-471-'),(472,'Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-Data-472-'),(473,'Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-Data-473-'),(474,'Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-Data-474-'),(475,'Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-Data-475-'),(476,'Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-Data-476-'),(477,'Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-Data-477-'),(478,'Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-Data-478-'),(479,'Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-Data-479-'),(480,'Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-Data-480-'),(481,'Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-Data-481-'),(482,'Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-Data-482-'),(483,'Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-Data-483-'),(484,'Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-Data-484-'),(485,'Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-Data-485-'),(486,'Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-Data-486-'),(487,'Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-Data-487-'),(488,'Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-Data-488-'),(489,'Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-Data-489-'),(490,'Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-Data-490-'),(491,'Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-Data-491-'),(492,'Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-Data-492-'),(493,'Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-Data-493-');
+INSERT INTO `multi_page` (`id`,`data`) VALUES (494,'Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-Data-494-'),(495,'Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-Data-495-'),(496,'Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-Data-496-'),(497,'Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-Data-497-'),(498,'Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-Data-498-'),(499,'Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-Data-499-'),(500,'Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-Data-500-');
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `nullable_no_pk` (`col1`,`col2`,`col3`,`col4`) VALUES (1,'Value1',100,'A'),(2,NULL,200,'B'),(NULL,'Value3',NULL,'C'),(4,'Value4',400,NULL),(NULL,NULL,NULL,NULL);
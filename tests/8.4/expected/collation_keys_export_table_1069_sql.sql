@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `collation_keys` (`id`,`first_name`,`last_name`,`email`,`department_id`,`created_at`) VALUES (1,'José','Müller','josé.müller@example.com',20,'2024-01-01 09:01:00'),(2,'Jose','Muller','jose.muller1@example.com',30,'2024-01-02 09:02:00'),(3,'jose','Mueller','jose_mueller@example.com',10,'2024-01-03 09:03:00'),(4,'JOSE','MÜLLER','JOSE.MULLER2@EXAMPLE.COM',20,'2024-01-04 09:04:00'),(5,'Zoë','Ångström','zoë@example.com',30,'2024-01-05 09:05:00'),(6,'Zoe','Angstrom','zoe1@example.com',10,'2024-01-06 09:06:00'),(7,'zoe','Andersen','zoe.andersen@example.com',20,'2024-01-07 09:07:00'),(8,'Ève','O\'Brien','ève.obrien@example.com',30,'2024-01-08 09:08:00'),(9,'Eve','Obrien','eve.obrien2@example.com',10,'2024-01-09 09:09:00'),(10,'eve','O Brien','eve-obrien@example.com',20,'2024-01-10 09:10:00'),(11,'Renée','de la Cruz','renée@example.com',30,'2024-01-11 09:11:00'),(12,'Renee','De la Cruz','renee.delacruz@example.com',10,'2024-01-12 09:12:00'),(13,'RENÉE','Delacroix','RENÉE.DELACROIX@EXAMPLE.COM',20,'2024-01-13 09:13:00'),(14,'Anaïs','van_Dijk','anaïs@example.com',30,'2024-01-14 09:14:00'),(15,'Anais','van Dijk','anais.vandijk@example.com',10,'2024-01-15 09:15:00'),(16,'François','Vandyke','françois@example.com',20,'2024-01-16 09:16:00'),(17,'Francois','Núñez','francois.nunez@example.com',30,'2024-01-17 09:17:00'),(18,'Léa','Nunez','léa.nunez@example.com',10,'2024-01-18 09:18:00'),(19,'Lea','Çelik','lea.celik@example.com',20,'2024-01-19 09:19:00'),(20,'LEA','Celik','LEA@EXAMPLE.COM',30,'2024-01-20 09:20:00'),(21,'Chloé','Öztürk','chloé@example.com',10,'2024-01-21 09:21:00'),(22,'Chloe','Ozturk','chloe.ozturk@example.com',20,'2024-01-22 09:22:00'),(23,'Noël','Schröder','noël@example.com',30,'2024-01-23 09:23:00'),(24,'Noel','Schroeder','noel.schroeder@example.com',10,'2024-01-24 09:24:00'),(25,'noel','Smith','noel_smith@example.com',20,'2024-01-25 09:25:00'),(26,'Élodie','smith-jones','élodie@example.com',30,'2024-01-26 09:26:00'),(27,'Elodie','Smith_Jones','elodie.smith@example.com',10,'2024-01-27 09:27:00'),(28,'Inès','Zoë','inès@example.com',20,'2024-01-28 09:28:00'),(29,'Ines','Zoe','ines.zoe@example.com',30,'2024-01-29 09:29:00'),(30,'Agnès','Éclair','agnès@example.com',10,'2024-01-30 09:30:00');
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `data_types` (`id`,`tiny_col`,`small_col`,`medium_col`,`big_col`,`float_col`,`double_col`,`decimal_col`,`char_col`,`varchar_col`,`text_col`,`binary_col`,`varbinary_col`,`blob_col`,`date_col`,`time_col`,`datetime_col`,`timestamp_col`,`year_col`,`enum_col`,`set_col`,`bit_col`,`json_col`) VALUES (1,127,32767,8388607,9223372036854775807,3.14,3.14159265359,'12345.67','CHAR10','Variable length string','This is a text field',0x0102030405060708090a0b0c0d0e0f10,0xdeadbeef,0xcafebabe,'2024-06-15','14:30:00','2024-06-15 14:30:00','2026-02-04 15:06:09',2024,'B','X,Z',170,'{\"key\":\"value\",\"number\":42}'),(2,-128,-32768,-8388608,-9223372036854775808,-1.5,-2.718281828,'-99999.99','ABC','Another string','More text here',0xffffffffffffffffffffffffffffffff,0x12345678,'','2000-01-01','00:00:00','2000-01-01 00:00:00','2000-01-01 00:00:01',2000,'A','Y',255,'[]'),(3,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `simple_table` (`id`,`name`,`age`,`email`) VALUES (1,'Alice',30,'alice@example.com'),(2,'Bob',25,'bob@example.com'),(3,'Charlie',35,'charlie@example.com'),(4,'Diana',28,'diana@example.com'),(5,'Eve',32,'eve@example.com');
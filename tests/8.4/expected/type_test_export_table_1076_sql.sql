@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `type_test` (`col_tinyint`,`col_smallint`,`col_mediumint`,`col_int`,`col_bigint`,`col_decimal_small`,`col_decimal_large`,`col_float`,`col_double`,`col_bit1`,`col_bit8`,`col_bit64`,`col_char_utf8`,`col_char_latin1`,`col_varchar_utf8`,`col_varchar_latin1`,`col_text_utf8`,`col_text_latin1`,`col_binary`,`col_varbinary`,`col_blob`,`col_datetime0`,`col_datetime3`,`col_datetime6`,`col_timestamp0`,`col_timestamp3`,`col_timestamp6`,`col_time0`,`col_time3`,`col_time6`,`col_date`,`col_year`,`col_geometry`,`col_point`,`col_linestring`,`col_polygon`,`col_multipoint`,`col_multilinestring`,`col_multipolygon`,`col_geometrycollection`,`col_enum`,`col_set`,`col_json`,`verify_column`) VALUES (-128,-32768,-8388608,1,-9223372036854775808,'-999.99','-99999.99999',-3.40282347e+38,-1.7976931348623157e+308,0,0,0,'','','','','','',0x00000000000000000000,'','','1000-01-01 00:00:00','1000-01-01 00:00:00.000','1000-01-01 00:00:00.000000','1970-01-01 00:00:01','1970-01-01 00:00:01.000','1970-01-01 00:00:01.000000','-838:59:59','-838:59:59.000','-838:59:59.000000','1000-01-01',1901,0x00000000010100000000000000000000000000000000000000,0x00000000010100000000000000000000000000000000000000,0x000000000102000000020000000000000000000000000000000000000000000000000000000000000000000000,0x0000000001030000000100000005000000000000000000000000000000000000000000000000000000000000000000f03f000000000000f03f000000000000f03f000000000000f03f000000000000000000000000000000000000000000000000,0x00000000010400000001000000010100000000000000000000000000000000000000,0x000000000105000000010000000102000000020000000000000000000000000000000000000000000000000000000000000000000000,0x0000000001060000000100000001030000000100000005000000000000000000000000000000000000000000000000000000000000000000f03f000000000000f03f000000000000f03f000000000000f03f000000000000000000000000000000000000000000000000,0x00000000010700000001000000010100000000000000000000000000000000000000,'small','','{}',666),(127,32767,8388607,2,9223372036854775807,'999.99','99999.99999',3.40282347e+38,1.7976931348623157e+308,1,255,18446744073709551615,'AAAAAAAAAA','BBBBBBBBBB','CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC','DDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDD','EEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEE','FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF',0x47474747474747474747,0x48484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848484848,0x494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949494949,'9999-12-30 23:59:59','9999-12-30 23:59:59.499','9999-12-30 23:59:59.499999','2038-01-19 03:14:07','2038-01-19 03:14:07.499','2038-01-19 03:14:07.499999','838:59:59','838:59:58.999','838:59:58.999999','9999-12-31',2155,0x00000000010100000000000000008066400000000000805640,0x00000000010100000000000000008066400000000000805640,0x0000000001020000000200000000000000008066c000000000008056c000000000008066400000000000805640,0x000000000103000000010000000500000000000000008066c000000000008056c000000000008066c0000000000080564000000000008066400000000000805640000000000080664000000000008056c000000000008066c000000000008056c0,0x00000000010400000002000000010100000000000000008066c000000000008056c0010100000000000000008066400000000000805640,0x0000000001050000000200000001020000000200000000000000008066c000000000008056c000000000008066400000000000805640010200000002000000000000000080664000000000008056c000000000008066c00000000000805640,0x000000000106000000010000000103000000010000000500000000000000008066c000000000008056c000000000008066c0000000000080564000000000008066400000000000805640000000000080664000000000008056c000000000008066c000000000008056c0,0x0000000001070000000200000001010000000000000000806640000000000080564001020000000200000000000000008066c000000000008056c000000000008066400000000000805640,'large','red,green,blue','{\"nested\":{\"array\":[1,2,3],\"object\":{\"key\":\"max\"}},\"number\":9999,\"string\":\"max\"}',666),(0,0,0,3,0,'0.00','0.00000',0,0,1,170,12297829382473034410,'Mixedä¸­æ–‡','Mixed','Mixed UTF8 ä¸­æ–‡','Mixed Latin1','Mixed Text UTF8 ä¸­æ–‡','Mixed Text Latin1',0x42494e4152595f4d4958,0x56415242494e4152595f4d4958,0x424c4f425f4d4958,'2024-01-01 12:00:00','2024-01-01 12:00:00.123','2024-01-01 12:00:00.123456','2024-01-01 12:00:00','2024-01-01 12:00:00.123','2024-01-01 12:00:00.123456','12:00:00','12:00:00.123','12:00:00.123456','2024-01-01',2024,0x00000000010100000000000000008046400000000000804640,0x00000000010100000000000000008046400000000000804640,0x0000000001020000000200000000000000008046c000000000008046c000000000008046400000000000804640,0x000000000103000000010000000500000000000000008046c000000000008046c000000000008046c0000000000080464000000000008046400000000000804640000000000080464000000000008046c000000000008046c000000000008046c0,0x00000000010400000002000000010100000000000000008046c000000000008046c0010100000000000000008046400000000000804640,0x0000000001050000000200000001020000000200000000000000008046c000000000008046c000000000008046400000000000804640010200000002000000000000000080464000000000008046c000000000008046c00000000000804640,0x000000000106000000010000000103000000010000000500000000000000008046c000000000008046c000000000008046c0000000000080464000000000008046400000000000804640000000000080464000000000008046c000000000008046c000000000008046c0,0x0000000001070000000200000001010000000000000000804640000000000080464001020000000200000000000000008046c000000000008046c000000000008046400000000000804640,'medium','red,blue','{\"mixed\":{\"array\":[1],\"object\":{\"key\":\"value\"}},\"number\":123,\"string\":\"mixed\"}',666);
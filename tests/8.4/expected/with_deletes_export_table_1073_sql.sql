@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `with_deletes` (`id`,`name`,`status`) VALUES (1,'Keep1',1),(3,'Keep3',3),(5,'Keep5',5),(7,'Keep7',7),(9,'Keep9',9);
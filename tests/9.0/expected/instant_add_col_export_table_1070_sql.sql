@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `instant_add_col` (`id`,`name`,`value`,`new_col1`,`new_col2`) VALUES (1,'Row1',100,10,'default_value'),(2,'Row2',200,0,'default_value'),(3,'Row3',300,0,'default_value'),(4,'Row4',400,40,'custom4'),(5,'Row5',500,50,'custom5');
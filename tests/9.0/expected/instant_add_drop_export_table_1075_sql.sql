@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `instant_add_drop` (`col_uint`,`col_datetime_0`,`col_datetime_6`) VALUES (1,'2026-02-04 15:01:01',NULL),(2,'2026-02-04 15:01:01','2026-02-04 15:01:01.000000'),(3,'2026-02-04 15:01:01','2026-02-04 15:01:01.000000');
@@ -0,0 +1,2 @@
+/*!40103 SET TIME_ZONE='+00:00' */;
+INSERT INTO `vector_test` (`id`,`description`,`embedding`,`embedding_large`,`json_col`) VALUES (1,'first vector',0x0000803f000000400000404000008040,0xcdcccc3dcdcc4c3e9a99993ecdcccc3e0000003f9a99193f3333333fcdcc4c3f6666663f0000803fcdcc8c3f9a99993f6666a63f3333b33f0000c03fcdcccc3f,'{\"key\":\"value\"}'),(2,'second vector',0x0000a0400000c0400000e04000000041,0x0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f0000803f,'[]'),(3,'null vectors',NULL,NULL,NULL);
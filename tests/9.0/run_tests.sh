@@ -242,23 +242,832 @@ test_parse_page_with_records() {
     fi
 }
 
+# Test: --parse-page --mmap (must match the pread golden file)
+test_parse_page_mmap() {
+    local fixture="$1"
+    local page_no="${2:-4}"
+    local name=$(basename "$fixture" .ibd)
+    local test_name="${name}_parse_page_${page_no}_records_mmap"
+    local expected_file="$EXPECTED_DIR/${name}_parse_page_${page_no}_records.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    # Shares the golden file of test_parse_page_with_records
+    if [ $UPDATE_MODE -eq 1 ]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --parse-page "$page_no" --mmap > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
 # Test: --list-leftmost-pages (requires index ID, extracted from list-tables output)
 test_list_leftmost_pages() {
     local fixture="$1"
     local name=$(basename "$fixture" .ibd)
 
-    # First, get the primary index ID from --list-tables output
+    # First, get the primary index ID from --list-tables output
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+
+    # Extract first index ID (typically the clustered index)
+    # Use POSIX-compatible grep+sed instead of grep -P (not available on macOS)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return  # No index found, skip
+    fi
+
+    local test_name="${name}_leftmost_pages_${index_id}"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --list-leftmost-pages "$index_id" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -30 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index
+test_parse_index() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    # Get the primary index ID
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    # Use POSIX-compatible grep+sed instead of grep -P (not available on macOS)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --threads (must match the single-threaded golden file)
+test_parse_index_threads() {
+    local fixture="$1"
+    local n_threads="${2:-4}"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_threads_${n_threads}"
+    local expected_file="$EXPECTED_DIR/${name}_parse_index_${index_id}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    # Shares the golden file of test_parse_index, nothing to update
+    if [ $UPDATE_MODE -eq 1 ]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --threads "$n_threads" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --io-depth (must match the serial golden file)
+test_parse_index_io_depth() {
+    local fixture="$1"
+    local io_depth="${2:-8}"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_io_depth_${io_depth}"
+    local expected_file="$EXPECTED_DIR/${name}_parse_index_${index_id}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    # Shares the golden file of test_parse_index, nothing to update
+    if [ $UPDATE_MODE -eq 1 ]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --io-depth "$io_depth" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --fast (page headers only)
+test_parse_index_fast() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_fast"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --fast > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --sample (estimated from random leaf pages)
+test_parse_index_sample() {
+    local fixture="$1"
+    local n_samples="$2"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_sample_${n_samples}"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --sample "$n_samples" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --lob-stats (only meaningful on fixtures with LOBs)
+test_parse_index_lob_stats() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_lob_stats"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --lob-stats > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --size-stats
+test_parse_index_size_stats() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_size_stats"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --size-stats > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --scan-file
+test_scan_file() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+    local test_name="${name}_scan_file"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --scan-file > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --parse-page --format json (stderr is dropped so the golden file is
+# valid JSON)
+test_parse_page_json() {
+    local fixture="$1"
+    local page_no="${2:-4}"
+    local name=$(basename "$fixture" .ibd)
+    local test_name="${name}_parse_page_${page_no}_json"
+    local expected_file="$EXPECTED_DIR/${name}_parse_page_${page_no}.json"
+    local output_file="$TMPDIR/${test_name}.json"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --parse-page "$page_no" --format json > "$output_file" 2>/dev/null || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --format csv
+test_parse_index_csv() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_csv"
+    local expected_file="$EXPECTED_DIR/${name}_parse_index_${index_id}.csv"
+    local output_file="$TMPDIR/${test_name}.csv"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --format csv > "$output_file" 2>/dev/null || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --analyze-index --format json
+test_parse_index_json() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_parse_index_${index_id}_json"
+    local expected_file="$EXPECTED_DIR/${name}_parse_index_${index_id}.json"
+    local output_file="$TMPDIR/${test_name}.json"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" --format json > "$output_file" 2>/dev/null || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: the LEAF-CHAIN counters of --analyze-index, checked against the
+# leaf chain walked page by page from the leftmost leaf page given by
+# --list-leftmost-pages, with extents of 64 pages of 16KB. There is no
+# golden file.
+test_leaf_chain() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+
+    if [ -z "$index_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_leaf_chain_${index_id}"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    local page_no=$("$IBDNINJA" --file "$fixture" --list-leftmost-pages "$index_id" 2>/dev/null | grep 'Level 0: page' | sed 's/.*page //')
+    local prev=""
+    local n_pages=0
+    local n_discontinuities=0
+    local n_extent_switches=0
+    local n_seeks=1
+    while [ -n "$page_no" ] && [ "$page_no" != "NULL" ] && [ $n_pages -lt 100000 ]; do
+        if [ -n "$prev" ]; then
+            if [ $((page_no / 64)) -ne $((prev / 64)) ]; then
+                n_extent_switches=$((n_extent_switches + 1))
+            fi
+            if [ "$page_no" -ne $((prev + 1)) ]; then
+                n_discontinuities=$((n_discontinuities + 1))
+                if [ $((page_no / 64)) -ne $((prev / 64)) ] || [ "$page_no" -lt "$prev" ]; then
+                    n_seeks=$((n_seeks + 1))
+                fi
+            fi
+        fi
+        n_pages=$((n_pages + 1))
+        prev="$page_no"
+        page_no=$("$IBDNINJA" --file "$fixture" --parse-page "$page_no" --no-print-record 2>/dev/null | grep 'Slibling pages no' | awk '{print $NF}')
+    done
+    local expected=$(awk -v d=$n_discontinuities -v p=$n_pages -v e=$n_extent_switches -v s=$n_seeks \
+        'BEGIN { printf "%d %.2f %d %d", d, p / (d + 1), e, s }')
+    local actual=$("$IBDNINJA" --file "$fixture" --analyze-index "$index_id" 2>/dev/null | grep -A4 'LEAF-CHAIN' | tail -4 | awk '{print $NF}' | tr '\n' ' ' | sed 's/ $//')
+
+    if [ "$expected" == "$actual" ]; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            echo "  walked: $expected, reported: $actual"
+        fi
+    fi
+}
+
+# Test: --export-table, the exported rows are compared as they are written
+test_export_table() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
     local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
 
-    # Extract first index ID (typically the clustered index)
-    # Use POSIX-compatible grep+sed instead of grep -P (not available on macOS)
-    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+    if [ -z "$table_id" ]; then
+        return
+    fi
 
-    if [ -z "$index_id" ]; then
-        return  # No index found, skip
+    local test_name="${name}_export_table_${table_id}"
+    local expected_file="$EXPECTED_DIR/${test_name}.csv"
+    local output_file="$TMPDIR/${test_name}.csv"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
     fi
 
-    local test_name="${name}_leftmost_pages_${index_id}"
+    "$IBDNINJA" --file "$fixture" --export-table "$table_id" --out "$output_file" > /dev/null 2>&1 || true
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --export-table --export-format sql with --threads, the key range
+# chunks are compared concatenated in order
+test_export_table_sql() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
+
+    if [ -z "$table_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_export_table_${table_id}_sql"
+    local expected_file="$EXPECTED_DIR/${test_name}.sql"
+    local output_file="$TMPDIR/${test_name}.sql"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --export-table "$table_id" --out "$output_file" \
+        --export-format sql --rows-per-insert 100 --threads 4 > /dev/null 2>&1 || true
+    cat "$output_file".[0-9]* > "$output_file" 2>/dev/null || true
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --export-table --export-format columnar, compared byte for byte
+test_export_table_columnar() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
+
+    if [ -z "$table_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_export_table_${table_id}_columnar"
+    local expected_file="$EXPECTED_DIR/${test_name}.col"
+    local output_file="$TMPDIR/${test_name}.col"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --export-table "$table_id" --out "$output_file" \
+        --export-format columnar > /dev/null 2>&1 || true
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if cmp -s "$expected_file" "$output_file"; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            cmp "$expected_file" "$output_file" || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --export-table --where, only the matching rows are exported. The
+# optional suffix tells several expressions on one fixture apart.
+test_export_table_where() {
+    local fixture="$1"
+    local where="$2"
+    local suffix="${3:-}"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
+
+    if [ -z "$table_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_export_table_${table_id}_where${suffix}"
+    local expected_file="$EXPECTED_DIR/${test_name}.csv"
+    local output_file="$TMPDIR/${test_name}.csv"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --export-table "$table_id" --out "$output_file" \
+        --where "$where" > /dev/null 2>&1 || true
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --lookup of each key given after the fixture, the outputs of the
+# lookups are compared concatenated
+test_lookup() {
+    local fixture="$1"
+    shift
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
+
+    if [ -z "$table_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_lookup_${table_id}"
     local expected_file="$EXPECTED_DIR/${test_name}.txt"
     local output_file="$TMPDIR/${test_name}.txt"
 
@@ -266,7 +1075,10 @@ test_list_leftmost_pages() {
         return
     fi
 
-    "$IBDNINJA" --file "$fixture" --list-leftmost-pages "$index_id" > "$output_file" 2>&1 || true
+    : > "$output_file"
+    for key in "$@"; do
+        "$IBDNINJA" --file "$fixture" --lookup "$table_id" -- $key >> "$output_file" 2>&1 || true
+    done
     normalize_output "$output_file"
 
     if [ $UPDATE_MODE -eq 1 ]; then
@@ -285,27 +1097,33 @@ test_list_leftmost_pages() {
     else
         log_fail "$test_name"
         if [ $VERBOSE -eq 1 ]; then
-            diff "$expected_file" "$output_file" | head -30 || true
+            diff "$expected_file" "$output_file" | head -50 || true
             echo ""
         fi
     fi
 }
 
-# Test: --analyze-index
-test_parse_index() {
+# Test: --range on the index with the given name, with the --from and --to
+# options that follow, after an optional _suffix of the golden file name
+test_range() {
     local fixture="$1"
+    local index_name="$2"
+    shift 2
+    local suffix=""
+    if [[ "$1" == _* ]]; then
+        suffix="$1"
+        shift
+    fi
     local name=$(basename "$fixture" .ibd)
 
-    # Get the primary index ID
     local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
-    # Use POSIX-compatible grep+sed instead of grep -P (not available on macOS)
-    local index_id=$(echo "$list_output" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
+    local index_id=$(echo "$list_output" | grep "name: ${index_name}\$" | grep -o 'Index\] id: [0-9]*' | head -1 | sed 's/Index\] id: //')
 
     if [ -z "$index_id" ]; then
         return
     fi
 
-    local test_name="${name}_parse_index_${index_id}"
+    local test_name="${name}_range_${index_id}${suffix}"
     local expected_file="$EXPECTED_DIR/${test_name}.txt"
     local output_file="$TMPDIR/${test_name}.txt"
 
@@ -313,7 +1131,89 @@ test_parse_index() {
         return
     fi
 
-    "$IBDNINJA" --file "$fixture" --analyze-index "$index_id" > "$output_file" 2>&1 || true
+    "$IBDNINJA" --file "$fixture" --range "$index_id" "$@" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --index-stats of the table in the fixture
+test_index_stats() {
+    local fixture="$1"
+    local name=$(basename "$fixture" .ibd)
+
+    local list_output=$("$IBDNINJA" --file "$fixture" --list-tables 2>&1)
+    local table_id=$(echo "$list_output" | grep -o 'Table\] id: [0-9]*' | head -1 | sed 's/Table\] id: //')
+
+    if [ -z "$table_id" ]; then
+        return
+    fi
+
+    local test_name="${name}_index_stats_${table_id}"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --file "$fixture" --index-stats "$table_id" > "$output_file" 2>&1 || true
+    normalize_output "$output_file"
+
+    if [ $UPDATE_MODE -eq 1 ]; then
+        cp "$output_file" "$expected_file"
+        log_info "Updated: $test_name"
+        return
+    fi
+
+    if [ ! -f "$expected_file" ]; then
+        log_skip "$test_name (no expected file)"
+        return
+    fi
+
+    if diff -q "$expected_file" "$output_file" > /dev/null 2>&1; then
+        log_pass "$test_name"
+    else
+        log_fail "$test_name"
+        if [ $VERBOSE -eq 1 ]; then
+            diff "$expected_file" "$output_file" | head -50 || true
+            echo ""
+        fi
+    fi
+}
+
+# Test: --datadir over the whole fixtures directory. Warnings are dropped
+# since the workers may print them in any order.
+test_datadir() {
+    local test_name="datadir"
+    local expected_file="$EXPECTED_DIR/${test_name}.txt"
+    local output_file="$TMPDIR/${test_name}.txt"
+
+    if [ -n "$FILTER" ] && [[ ! "$test_name" == *"$FILTER"* ]]; then
+        return
+    fi
+
+    "$IBDNINJA" --datadir "$FIXTURES_DIR" --threads 4 --io-depth 8 \
+        > "$output_file" 2>/dev/null || true
     normalize_output "$output_file"
 
     if [ $UPDATE_MODE -eq 1 ]; then
@@ -366,12 +1266,87 @@ for fixture in "$FIXTURES_DIR"/*.ibd; do
     test_list_tables "$fixture"
     test_parse_page "$fixture" 4
     test_parse_page_with_records "$fixture" 4
+    test_parse_page_mmap "$fixture" 4
     test_list_leftmost_pages "$fixture"
     test_parse_index "$fixture"
+    test_parse_index_threads "$fixture" 4
+    test_parse_index_io_depth "$fixture" 8
+    test_parse_index_fast "$fixture"
+    test_scan_file "$fixture"
+    test_parse_page_json "$fixture" 4
+    test_parse_index_csv "$fixture"
+    test_export_table "$fixture"
+    test_index_stats "$fixture"
+    case "$name" in
+        blob_*|json_*)
+            test_parse_index_lob_stats "$fixture"
+            ;;
+        *)
+            test_export_table_sql "$fixture"
+            test_export_table_columnar "$fixture"
+            ;;
+    esac
+    case "$name" in
+        multi_page)
+            test_leaf_chain "$fixture"
+            test_export_table_where "$fixture" \
+                "id >= 100 AND id < 103 OR id = 499"
+            test_lookup "$fixture" 1 30 500 0 501
+            test_range "$fixture" PRIMARY --from 28 --to 31
+            test_parse_index_sample "$fixture" 20
+            test_parse_index_size_stats "$fixture"
+            ;;
+        multi_index)
+            test_range "$fixture" idx_name --from smith --to smith
+            ;;
+        fragmented_leaves)
+            test_leaf_chain "$fixture"
+            test_parse_index_json "$fixture"
+            test_parse_index_sample "$fixture" 5
+            ;;
+        collation_keys)
+            # Keys equal or ordered only by the collation weights: accents
+            # and case under 0900_ai_ci, both counted by 0900_as_cs, and
+            # accented letters sorted as their base under general_ci. A range
+            # from AE, which has no exact 0900_ai_ci weight, scans all leaf
+            # pages.
+            test_range "$fixture" idx_name --from Muller --to Muller
+            test_range "$fixture" idx_name _as_cs \
+                --from Muller --from Jose --to Muller --to Jose
+            test_range "$fixture" idx_name _punct --from O --to Oz
+            test_range "$fixture" idx_name _unsupported \
+                --from $'\xc3\x86r\xc3\xb8' --to Celik
+            test_range "$fixture" idx_email --from e --to f
+            # --where compares by the same collations
+            test_export_table_where "$fixture" \
+                "last_name = 'muller' OR email = 'LEA.CELIK@EXAMPLE.COM'"
+            ;;
+        instant_add_drop)
+            test_lookup "$fixture" 2
+            ;;
+        nullable_no_pk)
+            test_export_table_where "$fixture" \
+                "col1 IS NULL OR NOT (col3 > 150)"
+            ;;
+        data_types)
+            test_export_table_where "$fixture" \
+                "decimal_col < 0 OR (char_col = 'CHAR10' AND float_col = 3.14)"
+            # Both rows only match when DECIMAL is compared digit by digit,
+            # the second literal has more digits than a long double holds
+            test_export_table_where "$fixture" \
+                "decimal_col = 1234567e-2 OR decimal_col < -99999.9899999999999999999999" \
+                _decimal
+            test_parse_index_size_stats "$fixture"
+            ;;
+    esac
 
     echo ""
 done
 
+echo -e "${BLUE}Testing: datadir${NC}"
+test_datadir
+echo ""
+
 #
 # Summary
 #
@@ -0,0 +1,643 @@
+#!/usr/bin/env python3
+#
+# synthesize_fixtures.py - Build .ibd fixtures that MySQL can't be made to
+# lay out on demand, by rewriting the multi_index fixture of each version
+#
+# Usage: ./synthesize_fixtures.py [version ...]   (default: 8.0 8.4 9.0)
+#
+# collation_keys.ibd
+#   The multi_index table as collation_keys, with last_name in
+#   utf8mb4_0900_ai_ci, first_name in utf8mb4_0900_as_cs and email in
+#   utf8mb4_general_ci, holding 30 rows whose names differ by accents,
+#   case and punctuation. idx_name and idx_email keep three records per
+#   page, so both are three levels deep.
+#
+# fragmented_leaves.ibd
+#   The multi_index table as fragmented_leaves, with 42 rows in 14 leaf
+#   pages of PRIMARY that are out of order in the file, some of them in
+#   the second extent, which belongs to the leaf segment.
+#
+# The pages are written the way InnoDB writes them (COMPACT records, page
+# directory, segment inodes, extent descriptor, CRC-32C checksums), with
+# the space id, index ids and LSNs of the multi_index fixture.
+#
+
+import json
+import os
+import struct
+import sys
+import zlib
+
+PAGE_SIZE = 16384
+FIL_NULL = 0xFFFFFFFF
+FIL_PAGE_INDEX = 0x45BF
+FIL_PAGE_SDI = 0x45BD
+
+PAGE_HEADER = 38
+PAGE_NEW_INFIMUM = 99
+PAGE_NEW_SUPREMUM = 112
+PAGE_NEW_SUPREMUM_END = 120
+FSEG_INODE_SIZE = 192
+FSEG_ARR_OFFSET = 64
+FSEG_FRAG_SLOTS = 32
+INODE_PAGE_FIRST = 50
+XDES_ARR_OFFSET = 150
+
+REC_STATUS_ORDINARY = 0
+REC_STATUS_NODE_PTR = 1
+REC_INFO_MIN_REC_FLAG = 0x10
+
+RECS_PER_PAGE = 3
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+# ------ CRC-32C page checksums ------
+
+def _crc32c_table():
+    table = []
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82F63B78 if crc & 1 else 0)
+        table.append(crc)
+    return table
+
+
+CRC32C_TABLE = _crc32c_table()
+
+
+def crc32c(data):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc = CRC32C_TABLE[(crc ^ b) & 0xFF] ^ (crc >> 8)
+    return crc ^ 0xFFFFFFFF
+
+
+def seal_page(page):
+    """Sets the checksum and the trailer, as innodb_checksum_algorithm=crc32"""
+    checksum = (crc32c(bytes(page[4:26])) ^
+                crc32c(bytes(page[38:PAGE_SIZE - 8]))) & 0xFFFFFFFF
+    struct.pack_into('>I', page, 0, checksum)
+    struct.pack_into('>I', page, PAGE_SIZE - 8, checksum)
+    page[PAGE_SIZE - 4:PAGE_SIZE] = page[20:24]
+
+
+# ------ Sort orders, as MySQL compares character data ------
+
+UCA_ASCII_ORDER = ("\t\n\v\f\r _-,;:!?.'\"()[]{}@*/\\&#%`^+<=>|~$0123456789"
+                   "abcdefghijklmnopqrstuvwxyz")
+UCA_ACCENTS = {'\u0301': 0x24, '\u0300': 0x25, '\u0302': 0x27,
+               '\u030a': 0x29, '\u0308': 0x2B, '\u0303': 0x2D,
+               '\u0327': 0x30}
+
+
+def _uca_chars(text):
+    """(letter, accent) of each character, by canonical decomposition"""
+    import unicodedata
+    chars = []
+    for ch in text:
+        decomposed = unicodedata.normalize('NFD', ch)
+        base = decomposed[0]
+        if base.lower() not in UCA_ASCII_ORDER or len(decomposed) > 2:
+            raise ValueError('no weight for %r' % ch)
+        accent = UCA_ACCENTS[decomposed[1]] if len(decomposed) == 2 else 0
+        chars.append((base, accent))
+    return chars
+
+
+def uca_key(text, case_and_accents):
+    """utf8mb4_0900_ai_ci, or utf8mb4_0900_as_cs with case_and_accents"""
+    chars = _uca_chars(text)
+    primary = [UCA_ASCII_ORDER.index(c.lower()) + 1 for c, _ in chars]
+    if not case_and_accents:
+        return (primary,)
+    secondary = []
+    tertiary = []
+    for c, accent in chars:
+        secondary.append(0x20)
+        tertiary.append(0x08 if c.isupper() else 0x02)
+        if accent:
+            secondary.append(accent)
+            tertiary.append(0x02)
+    return (primary, secondary, tertiary)
+
+
+def general_ci_key(text):
+    """utf8mb4_general_ci, which ignores trailing spaces"""
+    import unicodedata
+    weights = []
+    for ch in text.rstrip(' '):
+        if ord(ch) > 0xFF:
+            raise ValueError('no weight for %r' % ch)
+        weights.append(ord(unicodedata.normalize('NFD', ch)[0].upper()))
+    return weights
+
+
+# ------ Records ------
+
+class FieldDef:
+    def __init__(self, nullable=False, var_max=0):
+        # var_max is the maximum length in bytes of a variable-length field
+        self.nullable = nullable
+        self.var_max = var_max
+
+
+def encode_int(value):
+    return struct.pack('>I', (value + 0x80000000) & 0xFFFFFFFF)
+
+
+def encode_datetime(year, month, day, hour, minute, second):
+    ymd = ((year * 13 + month) << 5) | day
+    hms = (hour << 12) | (minute << 6) | second
+    return ((ymd << 17 | hms) + 0x8000000000).to_bytes(5, 'big')
+
+
+class Record:
+    """A COMPACT record: its header before the extra bytes, and its data"""
+
+    def __init__(self, defs, values, status=REC_STATUS_ORDINARY, info=0,
+                 child=None):
+        lens = b''
+        nulls = 0
+        n_nullable = sum(1 for d in defs if d.nullable)
+        data = b''
+        bit = 0
+        for d, value in zip(defs, values):
+            if d.nullable:
+                if value is None:
+                    nulls |= 1 << bit
+                bit += 1
+            if value is None:
+                continue
+            if d.var_max:
+                if d.var_max > 255 and len(value) >= 128:
+                    lens += bytes([0x80 | (len(value) >> 8),
+                                   len(value) & 0xFF])
+                else:
+                    lens += bytes([len(value)])
+            data += value
+        if child is not None:
+            data += struct.pack('>I', child)
+        # Both are read backwards from the extra bytes
+        null_bytes = nulls.to_bytes((n_nullable + 7) // 8, 'little')
+        self.header = lens[::-1] + null_bytes[::-1]
+        self.data = data
+        self.status = status
+        self.info = info
+
+
+def build_index_page(space_id, page_no, index_id, level, records, prev,
+                     next_, lsn, max_trx_id=0, seg_headers=b'',
+                     page_type=FIL_PAGE_INDEX):
+    page = bytearray(PAGE_SIZE)
+    struct.pack_into('>IIIQHQI', page, 4, page_no, prev, next_, lsn,
+                     page_type, 0, space_id)
+    # Records are stored in key order, each owner of a directory slot
+    # owning 4 of them, the supremum the rest
+    owners = set(range(3, len(records) - 1, 4))
+    origins = []
+    offset = PAGE_NEW_SUPREMUM_END
+    for rec in records:
+        offset += len(rec.header)
+        page[offset - len(rec.header):offset] = rec.header
+        offset += 5
+        origins.append(offset)
+        page[offset:offset + len(rec.data)] = rec.data
+        offset += len(rec.data)
+    heap_top = offset
+
+    chain = [PAGE_NEW_INFIMUM] + origins + [PAGE_NEW_SUPREMUM]
+    slots = [PAGE_NEW_INFIMUM]
+    n_owned = 0
+    for i, rec in enumerate(records):
+        origin = origins[i]
+        n_owned += 1
+        owned = 0
+        if i in owners:
+            owned = n_owned
+            n_owned = 0
+            slots.append(origin)
+        page[origin - 5] = rec.info | owned
+        struct.pack_into('>H', page, origin - 4, ((i + 2) << 3) | rec.status)
+        struct.pack_into('>H', page, origin - 2,
+                         (chain[i + 2] - origin) & 0xFFFF)
+    slots.append(PAGE_NEW_SUPREMUM)
+    page[94:99] = bytes([0x01, 0x00, 0x02]) + struct.pack(
+        '>H', (chain[1] - PAGE_NEW_INFIMUM) & 0xFFFF)
+    page[99:107] = b'infimum\0'
+    page[107:112] = bytes([n_owned + 1, 0x00, 0x0B, 0x00, 0x00])
+    page[112:120] = b'supremum'
+    for i, origin in enumerate(slots):
+        struct.pack_into('>H', page, PAGE_SIZE - 8 - 2 * (i + 1), origin)
+
+    n_recs = len(records)
+    struct.pack_into('>HHHHHHHHHQHQ', page, PAGE_HEADER,
+                     len(slots), heap_top, 0x8000 | (n_recs + 2), 0, 0,
+                     origins[-1] if records else 0, 2 if n_recs > 1 else 5,
+                     max(n_recs - 1, 0), n_recs, max_trx_id, level, index_id)
+    page[PAGE_HEADER + 36:PAGE_HEADER + 36 + len(seg_headers)] = seg_headers
+    return page
+
+
+class Tree:
+    """A B-tree of index_id, built bottom up from its sorted leaf records"""
+
+    def __init__(self, index_id, root, defs, n_key_fields):
+        self.index_id = index_id
+        self.root = root
+        self.defs = defs
+        self.n_key_fields = n_key_fields
+        # Page number and records of each page, per level from the leaves
+        self.levels = []
+
+    def build(self, leaf_values, leaf_per_page, node_per_page, alloc,
+              leaf_pages=None):
+        """leaf_pages gives the page numbers of the leaves in key order"""
+        values = leaf_values
+        per_page = leaf_per_page
+        while True:
+            if len(values) <= per_page:
+                self.levels.append([(self.root, values)])
+                return
+            chunks = [values[i:i + per_page]
+                      for i in range(0, len(values), per_page)]
+            if leaf_pages is not None and not self.levels:
+                assert len(leaf_pages) == len(chunks)
+                pages = list(zip(leaf_pages, chunks))
+            else:
+                pages = [(alloc(), chunk) for chunk in chunks]
+            self.levels.append(pages)
+            # The node pointers repeat the first key of each child page
+            values = [chunk[0][:self.n_key_fields] + [('child', page_no)]
+                      for page_no, chunk in pages]
+            per_page = node_per_page
+
+    def pages(self):
+        for level, pages in enumerate(self.levels):
+            for i, (page_no, values) in enumerate(pages):
+                prev = pages[i - 1][0] if i > 0 else FIL_NULL
+                next_ = pages[i + 1][0] if i + 1 < len(pages) else FIL_NULL
+                records = []
+                for j, value in enumerate(values):
+                    if level == 0:
+                        records.append(Record(self.defs, value))
+                        continue
+                    child = value[-1][1]
+                    info = REC_INFO_MIN_REC_FLAG if (i == 0 and j == 0) else 0
+                    records.append(Record(self.defs[:self.n_key_fields],
+                                          value[:-1], REC_STATUS_NODE_PTR,
+                                          info, child))
+                yield level, page_no, prev, next_, records
+
+    def leaf_pages(self):
+        return [p for p, _ in self.levels[0]] if len(self.levels) > 1 else []
+
+    def non_leaf_pages(self):
+        return [p for pages in self.levels[1:] for p, _ in pages
+                if p != self.root]
+
+
+# ------ The source fixture ------
+
+def read_records(page):
+    """Origins of the user records of an INDEX page, in key order"""
+    origins = []
+    offset = PAGE_NEW_INFIMUM
+    while True:
+        offset = (offset + struct.unpack_from('>h', page, offset - 2)[0]) \
+            % PAGE_SIZE
+        if offset == PAGE_NEW_SUPREMUM:
+            return origins
+        origins.append(offset)
+
+
+def read_sdi(page):
+    """(type, id, system columns, JSON) of each SDI record on the SDI root"""
+    sdi = []
+    for origin in read_records(page):
+        sdi_type, sdi_id = struct.unpack_from('>IQ', page, origin)
+        sys_cols = bytes(page[origin + 12:origin + 25])
+        _, comp_len = struct.unpack_from('>II', page, origin + 25)
+        data = bytes(page[origin + 33:origin + 33 + comp_len])
+        sdi.append((sdi_type, sdi_id, sys_cols,
+                    json.loads(zlib.decompress(data))))
+    return sdi
+
+
+SDI_DEFS = [FieldDef(), FieldDef(), FieldDef(), FieldDef(), FieldDef(),
+            FieldDef(), FieldDef(var_max=0xFFFFFFFF)]
+
+
+def sdi_record(sdi_type, sdi_id, sys_cols, obj):
+    text = json.dumps(obj).encode()
+    comp = zlib.compress(text)
+    return Record(SDI_DEFS, [struct.pack('>I', sdi_type),
+                             struct.pack('>Q', sdi_id), sys_cols[:6],
+                             sys_cols[6:], struct.pack('>I', len(text)),
+                             struct.pack('>I', len(comp)), comp])
+
+
+# ------ The multi_index table, rewritten ------
+
+XDES_ENTRY_SIZE = 40
+XDES_FSEG = 4
+EXTENT_SIZE = 64
+
+
+class Fixture:
+    """The pages of multi_index.ibd, with the table renamed"""
+
+    def __init__(self, version, name, collation_ids=None):
+        self.fixtures = os.path.join(SCRIPT_DIR, version, 'fixtures')
+        self.name = name
+        with open(os.path.join(self.fixtures, 'multi_index.ibd'), 'rb') as f:
+            src = f.read()
+        self.pages = [bytearray(src[i:i + PAGE_SIZE])
+                      for i in range(0, len(src), PAGE_SIZE)]
+        self.space_id = struct.unpack_from('>I', self.pages[0], 34)[0]
+        self.lsn = max(struct.unpack_from('>Q', p, 16)[0]
+                       for p in self.pages)
+
+        sdi = read_sdi(self.pages[3])
+        table = None
+        for _, _, _, obj in sdi:
+            if obj['dd_object_type'] == 'Table':
+                table = obj['dd_object']
+        text = json.dumps([obj for _, _, _, obj in sdi])
+        sdi_objs = json.loads(text.replace('multi_index', name))
+        for obj in sdi_objs:
+            if obj['dd_object_type'] == 'Table':
+                for col in obj['dd_object']['columns']:
+                    if col['name'] in (collation_ids or {}):
+                        col['collation_id'] = collation_ids[col['name']]
+        sdi_recs = [sdi_record(t, i, s, obj)
+                    for (t, i, s, _), obj in zip(sdi, sdi_objs)]
+        sdi_page = self.pages[3]
+        self.pages[3] = build_index_page(
+            self.space_id, 3,
+            struct.unpack_from('>Q', sdi_page, PAGE_HEADER + 28)[0],
+            0, sdi_recs, FIL_NULL, FIL_NULL,
+            struct.unpack_from('>Q', sdi_page, 16)[0],
+            seg_headers=sdi_page[PAGE_HEADER + 36:PAGE_HEADER + 56],
+            page_type=FIL_PAGE_SDI)
+
+        self.index_ids = {}
+        for index in table['indexes']:
+            private = dict(kv.split('=') for kv in
+                           index['se_private_data'].strip(';').split(';'))
+            self.index_ids[index['name']] = (int(private['id']),
+                                             int(private['root']))
+
+        # DB_TRX_ID and DB_ROLL_PTR of the rows, as inserted by one
+        # transaction
+        primary_root = self.pages[self.index_ids['PRIMARY'][1]]
+        self.sys_cols = bytes(
+            primary_root[read_records(primary_root)[0] + 4:][:13])
+        self.max_trx_id = struct.unpack_from(
+            '>Q', self.pages[self.index_ids['idx_name'][1]],
+            PAGE_HEADER + 18)[0]
+        self.next_page = 8
+        self.trees = []
+
+    def alloc(self):
+        self.next_page += 1
+        return self.next_page - 1
+
+    def index_defs(self, name_key, email_key):
+        """(name, field definitions, key fields, sort key, field values) of
+        each index, sorting the names and emails by the given keys"""
+        name = FieldDef(nullable=True, var_max=200)
+        email = FieldDef(nullable=True, var_max=1020)
+        dept = FieldDef(nullable=True)
+        pk = FieldDef()
+        sys_cols = self.sys_cols
+        return [
+            ('PRIMARY', [pk, FieldDef(), FieldDef(), name, name, email, dept,
+                         FieldDef(nullable=True)], 1,
+             lambda r: r['id'],
+             lambda r: [encode_int(r['id']), sys_cols[:6], sys_cols[6:],
+                        r['first_name'].encode(), r['last_name'].encode(),
+                        r['email'].encode(), encode_int(r['department_id']),
+                        r['created_at']]),
+            ('idx_email', [email, pk], 2,
+             lambda r: (email_key(r['email']), r['id']),
+             lambda r: [r['email'].encode(), encode_int(r['id'])]),
+            ('idx_name', [name, name, pk], 3,
+             lambda r: (name_key(r['last_name'], False),
+                        name_key(r['first_name'], True), r['id']),
+             lambda r: [r['last_name'].encode(), r['first_name'].encode(),
+                        encode_int(r['id'])]),
+            ('idx_dept', [dept, pk], 2,
+             lambda r: (r['department_id'], r['id']),
+             lambda r: [encode_int(r['department_id']),
+                        encode_int(r['id'])]),
+        ]
+
+    def add_tree(self, index, rows, leaf_per_page, node_per_page,
+                 leaf_pages=None):
+        index_name, defs, n_key_fields, key, values = index
+        index_id, root = self.index_ids[index_name]
+        tree = Tree(index_id, root, defs, n_key_fields)
+        tree.build([values(r) for r in sorted(rows, key=key)],
+                   leaf_per_page, node_per_page, self.alloc, leaf_pages)
+        self.trees.append((index_name, tree))
+
+    def write(self):
+        pages = self.pages
+        used = set(range(8))
+        n_pages = max([self.next_page] +
+                      [p + 1 for _, tree in self.trees
+                       for p in tree.leaf_pages()])
+        pages += [bytearray(PAGE_SIZE) for _ in range(n_pages - len(pages))]
+        fsp = pages[0]
+        inode = pages[2]
+        for index_name, tree in self.trees:
+            seg_headers = bytes(
+                pages[tree.root][PAGE_HEADER + 36:PAGE_HEADER + 56])
+            for level, page_no, prev, next_, records in tree.pages():
+                trx = 0 if index_name == 'PRIMARY' else self.max_trx_id
+                pages[page_no] = build_index_page(
+                    self.space_id, page_no, tree.index_id, level, records,
+                    prev, next_, self.lsn, trx,
+                    seg_headers if page_no == tree.root else b'')
+                used.add(page_no)
+            for seg, seg_pages in ((0, tree.leaf_pages()),
+                                   (10, [tree.root] + tree.non_leaf_pages())):
+                inode_offset = struct.unpack_from('>H', seg_headers,
+                                                  seg + 8)[0]
+                self.fill_segment(inode, inode_offset, seg_pages)
+
+        # The first extent holds the fragment pages
+        struct.pack_into('>I', fsp, PAGE_HEADER + 8, n_pages)
+        n_extents = (n_pages + EXTENT_SIZE - 1) // EXTENT_SIZE
+        struct.pack_into('>I', fsp, PAGE_HEADER + 12,
+                         max(n_extents, 1) * EXTENT_SIZE)
+        struct.pack_into('>I', fsp, PAGE_HEADER + 20,
+                         sum(1 for p in used if p < EXTENT_SIZE))
+        self.set_xdes_bitmap(0, used)
+
+        for page_no in sorted(used | {0, 2, 3}):
+            seal_page(pages[page_no])
+        out = os.path.join(self.fixtures, self.name + '.ibd')
+        with open(out, 'wb') as f:
+            for page in pages:
+                f.write(page)
+        print('Wrote %s: %u pages' % (out, n_pages))
+
+    def set_xdes_bitmap(self, extent, used):
+        bitmap = bytearray(16)
+        for i in range(EXTENT_SIZE):
+            bits = 0b10 if extent * EXTENT_SIZE + i in used else 0b11
+            bitmap[i // 4] |= bits << (2 * (i % 4))
+        offset = XDES_ARR_OFFSET + extent * XDES_ENTRY_SIZE
+        self.pages[0][offset + 24:offset + 40] = bitmap
+
+    def fill_segment(self, inode, inode_offset, seg_pages):
+        """The pages of the first extent are fragment pages of the segment,
+        the extents after it belong to the segment, in its not full list"""
+        frag = [p for p in seg_pages if p < EXTENT_SIZE]
+        assert len(frag) <= FSEG_FRAG_SLOTS
+        for i in range(FSEG_FRAG_SLOTS):
+            struct.pack_into('>I', inode,
+                             inode_offset + FSEG_ARR_OFFSET + 4 * i,
+                             frag[i] if i < len(frag) else FIL_NULL)
+        extents = sorted({p // EXTENT_SIZE for p in seg_pages
+                          if p >= EXTENT_SIZE})
+        if not extents:
+            return
+        fsp = self.pages[0]
+        seg_id = inode[inode_offset:inode_offset + 8]
+        n_used = 0
+        nodes = [XDES_ARR_OFFSET + e * XDES_ENTRY_SIZE + 8 for e in extents]
+        for i, extent in enumerate(extents):
+            in_extent = {p for p in seg_pages if p // EXTENT_SIZE == extent}
+            assert len(in_extent) < EXTENT_SIZE
+            n_used += len(in_extent)
+            offset = XDES_ARR_OFFSET + extent * XDES_ENTRY_SIZE
+            fsp[offset:offset + 8] = seg_id
+            prev = nodes[i - 1] if i > 0 else None
+            next_ = nodes[i + 1] if i + 1 < len(nodes) else None
+            for addr_offset, node in ((8, prev), (14, next_)):
+                struct.pack_into('>IH', fsp, offset + addr_offset,
+                                 FIL_NULL if node is None else 0,
+                                 0 if node is None else node)
+            struct.pack_into('>I', fsp, offset + 20, XDES_FSEG)
+            self.set_xdes_bitmap(extent, in_extent)
+        # FSEG_NOT_FULL_N_USED, then the base node of FSEG_NOT_FULL
+        struct.pack_into('>I', inode, inode_offset + 8, n_used)
+        struct.pack_into('>IIHIH', inode, inode_offset + 28, len(extents),
+                         0, nodes[0], 0, nodes[-1])
+
+
+# ------ collation_keys.ibd ------
+
+COLLATION_IDS = {'last_name': 255,     # utf8mb4_0900_ai_ci
+                 'first_name': 278,    # utf8mb4_0900_as_cs
+                 'email': 45}          # utf8mb4_general_ci
+
+# (first_name, last_name, email), id is the position from 1
+COLLATION_ROWS = [
+    ('José', 'Müller', 'josé.müller@example.com'),
+    ('Jose', 'Muller', 'jose.muller1@example.com'),
+    ('jose', 'Mueller', 'jose_mueller@example.com'),
+    ('JOSE', 'MÜLLER', 'JOSE.MULLER2@EXAMPLE.COM'),
+    ('Zoë', 'Ångström', 'zoë@example.com'),
+    ('Zoe', 'Angstrom', 'zoe1@example.com'),
+    ('zoe', 'Andersen', 'zoe.andersen@example.com'),
+    ('Ève', "O'Brien", 'ève.obrien@example.com'),
+    ('Eve', 'Obrien', 'eve.obrien2@example.com'),
+    ('eve', 'O Brien', 'eve-obrien@example.com'),
+    ('Renée', 'de la Cruz', 'renée@example.com'),
+    ('Renee', 'De la Cruz', 'renee.delacruz@example.com'),
+    ('RENÉE', 'Delacroix', 'RENÉE.DELACROIX@EXAMPLE.COM'),
+    ('Anaïs', 'van_Dijk', 'anaïs@example.com'),
+    ('Anais', 'van Dijk', 'anais.vandijk@example.com'),
+    ('François', 'Vandyke', 'françois@example.com'),
+    ('Francois', 'Núñez', 'francois.nunez@example.com'),
+    ('Léa', 'Nunez', 'léa.nunez@example.com'),
+    ('Lea', 'Çelik', 'lea.celik@example.com'),
+    ('LEA', 'Celik', 'LEA@EXAMPLE.COM'),
+    ('Chloé', 'Öztürk', 'chloé@example.com'),
+    ('Chloe', 'Ozturk', 'chloe.ozturk@example.com'),
+    ('Noël', 'Schröder', 'noël@example.com'),
+    ('Noel', 'Schroeder', 'noel.schroeder@example.com'),
+    ('noel', 'Smith', 'noel_smith@example.com'),
+    ('Élodie', 'smith-jones', 'élodie@example.com'),
+    ('Elodie', 'Smith_Jones', 'elodie.smith@example.com'),
+    ('Inès', 'Zoë', 'inès@example.com'),
+    ('Ines', 'Zoe', 'ines.zoe@example.com'),
+    ('Agnès', 'Éclair', 'agnès@example.com'),
+]
+
+
+def synthesize_collation_keys(version):
+    fixture = Fixture(version, 'collation_keys', COLLATION_IDS)
+    rows = []
+    for i, (first, last, email) in enumerate(COLLATION_ROWS):
+        row_id = i + 1
+        rows.append({'id': row_id, 'first_name': first, 'last_name': last,
+                     'email': email, 'department_id': 10 * (row_id % 3 + 1),
+                     'created_at': encode_datetime(2024, 1, row_id, 9,
+                                                   row_id, 0)})
+    emails = [general_ci_key(r['email']) for r in rows]
+    assert len(set(map(tuple, emails))) == len(emails), 'idx_email is UNIQUE'
+
+    # Only the secondary names are split, PRIMARY and idx_dept stay in
+    # their roots
+    for index in fixture.index_defs(uca_key, general_ci_key):
+        if index[0] in ('idx_name', 'idx_email'):
+            fixture.add_tree(index, rows, RECS_PER_PAGE, RECS_PER_PAGE)
+        else:
+            fixture.add_tree(index, rows, len(rows), len(rows))
+    fixture.write()
+
+
+# ------ fragmented_leaves.ibd ------
+
+# The leaf pages of PRIMARY in key order: runs of consecutive pages, a
+# jump to the second extent and back, one page forward and one back in
+# the same extent, and a run across the extent boundary. Along the chain
+# there are 5 discontinuities (6 runs, 14 / 6 = 2.33 pages on average), 3
+# extent switches (8 -> 70, 72 -> 11, 63 -> 64) and 4 seeks (the first
+# page, 70, 11 and back from 13 to 12).
+FRAGMENTED_LEAF_PAGES = [8, 9, 10, 70, 71, 72, 11, 13, 12, 62, 63, 64, 65,
+                         66]
+
+
+def synthesize_fragmented_leaves(version):
+    fixture = Fixture(version, 'fragmented_leaves')
+    rows = []
+    for i in range(len(FRAGMENTED_LEAF_PAGES) * RECS_PER_PAGE):
+        row_id = i + 1
+        rows.append({'id': row_id, 'first_name': 'First%02u' % row_id,
+                     'last_name': 'Last%02u' % (row_id % 7),
+                     'email': 'user%02u@example.com' % row_id,
+                     'department_id': 10 * (row_id % 3 + 1),
+                     'created_at': encode_datetime(2024, 2, row_id % 28 + 1,
+                                                   9, row_id, 0)})
+
+    # The names are ASCII letters and digits in one case, which sort as
+    # their bytes in any collation. The secondary indexes stay in their
+    # roots.
+    def ascii_key(text, case_sensitive=None):
+        return text
+
+    for index in fixture.index_defs(ascii_key, ascii_key):
+        if index[0] == 'PRIMARY':
+            fixture.add_tree(index, rows, RECS_PER_PAGE, len(rows),
+                             FRAGMENTED_LEAF_PAGES)
+        else:
+            fixture.add_tree(index, rows, len(rows), len(rows))
+    fixture.write()
+
+
+def main():
+    versions = sys.argv[1:] or ['8.0', '8.4', '9.0']
+    for version in versions:
+        synthesize_collation_keys(version)
+        synthesize_fragmented_leaves(version)
+
+
+if __name__ == '__main__':
+    main()